@@ -114,6 +114,8 @@ bool FPCGExAssetStagingElement::PostBoot(FPCGExContext* InContext) const
 
 	Context->MainCollection->LoadCache();
 
+	if (Context->CollectionPickDatasetPacker) { Context->CollectionPickDatasetPacker->RegisterCollection(Context->MainCollection); }
+
 	return FPCGExPointsProcessorElement::PostBoot(InContext);
 }
 
@@ -136,12 +136,12 @@ bool UPCGExMeshSelectorStaged::SelectInstances(
 
 						{
 							TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExMeshSelectorStaged::FillInstances);
-							for (const TPair<int64, TSharedPtr<TArray<int32>>>& Partition : CollectionMap->HashedPartitions)
+							for (int p = 0; p < CollectionMap->NumPartitions(); p++)
 							{
 								const FPCGExMeshCollectionEntry* Entry = nullptr;
-								if (!CollectionMap->ResolveEntry(Partition.Key, Entry)) { continue; }
+								if (!CollectionMap->ResolveEntry(CollectionMap->PartitionKeys[p], Entry)) { continue; }
 
-								const TArray<int32>& Indices = *Partition.Value.Get();
+								const TArrayView<const int32> Indices = CollectionMap->GetPartition(p);
 								TArray<FTransform> Instances;
 								const int32 PartitionSize = Indices.Num();
 								PCGEx::InitArray(Instances, PartitionSize);
@@ -205,12 +205,12 @@ bool UPCGExMeshSelectorStaged::SelectInstances(
 			TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExMeshSelectorStaged::FillInstances);
 			const TArray<FPCGPoint>& InPoints = InPointData->GetPoints();
 
-			for (const TPair<int64, TSharedPtr<TArray<int32>>>& Partition : CollectionMap->HashedPartitions)
+			for (int p = 0; p < CollectionMap->NumPartitions(); p++)
 			{
 				const FPCGExMeshCollectionEntry* Entry = nullptr;
-				if (!CollectionMap->ResolveEntry(Partition.Key, Entry)) { continue; }
+				if (!CollectionMap->ResolveEntry(CollectionMap->PartitionKeys[p], Entry)) { continue; }
 
-				const TArray<int32>& Indices = *Partition.Value.Get();
+				const TArrayView<const int32> Indices = CollectionMap->GetPartition(p);
 				TArray<FTransform> Instances;
 				const int32 PartitionSize = Indices.Num();
 				PCGEx::InitArray(Instances, PartitionSize);
@@ -0,0 +1,132 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "AssetStaging/PCGExStaging.h"
+
+#include "PCGExGlobalSettings.h"
+#include "Async/ParallelFor.h"
+
+namespace PCGExStaging
+{
+	void BuildPartitions(const TArray<int64>& InHashes, TArray<int64>& OutKeys, TArray<int32>& OutOffsets, TArray<int32>& OutIndices)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExStaging::BuildPartitions);
+
+		const int32 NumPoints = InHashes.Num();
+
+		OutKeys.Reset();
+		OutOffsets.Reset();
+		OutIndices.Reset();
+
+		if (!NumPoints) { return; }
+
+		// Selection runs outside of any PCGEx task manager, so scopes are dispatched directly.
+		TArray<PCGExMT::FScope> Scopes;
+		const int32 NumScopes = PCGExMT::SubLoopScopes(Scopes, NumPoints, FMath::Max(1, GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize()));
+
+		// 1 - Each scope assigns scope-local partition ids against its own key map, in order of first appearance
+		TArray<int32> PointPartitions;
+		PointPartitions.SetNumUninitialized(NumPoints);
+
+		TArray<TArray<int64>> ScopeKeys;
+		TArray<TArray<int32>> ScopeCounts;
+		ScopeKeys.SetNum(NumScopes);
+		ScopeCounts.SetNum(NumScopes);
+
+		ParallelFor(
+			NumScopes, [&](const int32 ScopeIndex)
+			{
+				const PCGExMT::FScope& Scope = Scopes[ScopeIndex];
+				TArray<int64>& Keys = ScopeKeys[ScopeIndex];
+				TArray<int32>& Counts = ScopeCounts[ScopeIndex];
+
+				TMap<int64, int32> LocalMap;
+				for (int i = Scope.Start; i < Scope.End; i++)
+				{
+					const int64 EntryHash = InHashes[i];
+					if (const int32* LocalIndex = LocalMap.Find(EntryHash))
+					{
+						PointPartitions[i] = *LocalIndex;
+						Counts[*LocalIndex]++;
+						continue;
+					}
+
+					const int32 LocalIndex = Keys.Add(EntryHash);
+					LocalMap.Add(EntryHash, LocalIndex);
+					Counts.Add(1);
+					PointPartitions[i] = LocalIndex;
+				}
+			});
+
+		// 2 - Merge scope keys into global partitions. Scopes are visited in order, so the global order is still first appearance.
+		TArray<TArray<int32>> ScopeRemaps;
+		ScopeRemaps.SetNum(NumScopes);
+
+		{
+			TMap<int64, int32> PartitionMap;
+			for (int s = 0; s < NumScopes; s++)
+			{
+				const TArray<int64>& Keys = ScopeKeys[s];
+				TArray<int32>& Remap = ScopeRemaps[s];
+				Remap.SetNumUninitialized(Keys.Num());
+
+				for (int k = 0; k < Keys.Num(); k++)
+				{
+					if (const int32* PartitionIndex = PartitionMap.Find(Keys[k])) { Remap[k] = *PartitionIndex; }
+					else { PartitionMap.Add(Keys[k], Remap[k] = OutKeys.Add(Keys[k])); }
+				}
+			}
+		}
+
+		// 3 - Turn counts into write offsets. Scopes are laid out in order inside each partition, so indices remain sorted.
+		const int32 NumPartitions = OutKeys.Num();
+
+		TArray<int32> PartitionCounts;
+		PartitionCounts.SetNumZeroed(NumPartitions);
+		for (int s = 0; s < NumScopes; s++)
+		{
+			const TArray<int32>& Remap = ScopeRemaps[s];
+			const TArray<int32>& Counts = ScopeCounts[s];
+			for (int k = 0; k < Counts.Num(); k++) { PartitionCounts[Remap[k]] += Counts[k]; }
+		}
+
+		OutOffsets.SetNumUninitialized(NumPartitions + 1);
+
+		int32 Offset = 0;
+		for (int p = 0; p < NumPartitions; p++)
+		{
+			OutOffsets[p] = Offset;
+			Offset += PartitionCounts[p];
+		}
+
+		OutOffsets[NumPartitions] = Offset;
+
+		// Scope counts become each scope's first write index inside its partitions
+		PartitionCounts.SetNumUninitialized(NumPartitions);
+		FMemory::Memcpy(PartitionCounts.GetData(), OutOffsets.GetData(), NumPartitions * sizeof(int32));
+
+		for (int s = 0; s < NumScopes; s++)
+		{
+			const TArray<int32>& Remap = ScopeRemaps[s];
+			TArray<int32>& Counts = ScopeCounts[s];
+			for (int k = 0; k < Counts.Num(); k++)
+			{
+				int32& Cursor = PartitionCounts[Remap[k]];
+				const int32 Count = Counts[k];
+				Counts[k] = Cursor;
+				Cursor += Count;
+			}
+		}
+
+		// 4 - Scatter point indices
+		OutIndices.SetNumUninitialized(NumPoints);
+
+		ParallelFor(
+			NumScopes, [&](const int32 ScopeIndex)
+			{
+				const PCGExMT::FScope& Scope = Scopes[ScopeIndex];
+				TArray<int32>& WriteOffsets = ScopeCounts[ScopeIndex];
+				for (int i = Scope.Start; i < Scope.End; i++) { OutIndices[WriteOffsets[PointPartitions[i]]++] = i; }
+			});
+	}
+}
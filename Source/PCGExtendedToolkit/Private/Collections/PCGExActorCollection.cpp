@@ -17,6 +17,13 @@ bool FPCGExActorCollectionEntry::Validate(const UPCGExAssetCollection* ParentCol
 	return Super::Validate(ParentCollection);
 }
 
+uint32 FPCGExActorCollectionEntry::GetCacheHash() const
+{
+	const bool bHasSubCollection = SubCollection != nullptr;
+	const bool bHasAsset = !Actor.IsNull();
+	return HashCombine(Super::GetCacheHash(), HashCombine(GetTypeHash(bHasSubCollection), GetTypeHash(bHasAsset)));
+}
+
 #if WITH_EDITOR
 void FPCGExActorCollectionEntry::EDITOR_Sanitize()
 {
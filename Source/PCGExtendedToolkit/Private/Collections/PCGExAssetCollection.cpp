@@ -97,6 +97,27 @@ namespace PCGExAssetCollection
 			Weights[i] = WeightSum;
 		}
 	}
+
+	void FCategory::Bake(FPCGExAssetCollectionBakedCategory& OutBaked) const
+	{
+		OutBaked.Name = Name;
+		OutBaked.WeightSum = WeightSum;
+		OutBaked.Indices = Indices;
+		OutBaked.Weights = Weights;
+		OutBaked.Order = Order;
+	}
+
+	void FCategory::Restore(const FPCGExAssetCollectionBakedCategory& InBaked, TFunctionRef<const FPCGExAssetCollectionEntry*(const int32)> GetEntry)
+	{
+		Name = InBaked.Name;
+		WeightSum = InBaked.WeightSum;
+		Indices = InBaked.Indices;
+		Weights = InBaked.Weights;
+		Order = InBaked.Order;
+
+		Entries.SetNumUninitialized(Indices.Num());
+		for (int32 i = 0; i < Indices.Num(); i++) { Entries[i] = GetEntry(Indices[i]); }
+	}
 }
 
 #if WITH_EDITOR
@@ -115,6 +136,15 @@ bool FPCGExAssetCollectionEntry::Validate(const UPCGExAssetCollection* ParentCol
 	return true;
 }
 
+uint32 FPCGExAssetCollectionEntry::GetCacheHash() const
+{
+	// Names & paths are hashed from their string so the hash survives reloads
+	uint32 Hash = HashCombine(GetTypeHash(Weight), GetTypeHash(bIsSubCollection));
+	Hash = HashCombine(Hash, FCrc::StrCrc32(*Category.ToString()));
+	if (bIsSubCollection && InternalSubCollection) { Hash = HashCombine(Hash, FCrc::StrCrc32(*InternalSubCollection->GetPathName())); }
+	return Hash;
+}
+
 void FPCGExAssetCollectionEntry::UpdateStaging(const UPCGExAssetCollection* OwningCollection, const int32 InInternalIndex, const bool bRecursive)
 {
 	Staging.InternalIndex = InInternalIndex;
@@ -235,6 +265,34 @@ namespace PCGExAssetCollection
 		Main->Compile();
 		for (const TPair<FName, TSharedPtr<FCategory>>& Pair : Categories) { Pair.Value->Compile(); }
 	}
+
+	void FCache::Bake(FPCGExAssetCollectionBakedCache& OutBaked, const uint32 InEntriesHash) const
+	{
+		OutBaked.bValid = true;
+		OutBaked.EntriesHash = InEntriesHash;
+		OutBaked.WeightSum = WeightSum;
+
+		Main->Bake(OutBaked.Main);
+
+		OutBaked.Categories.Reset(Categories.Num());
+		for (const TPair<FName, TSharedPtr<FCategory>>& Pair : Categories) { Pair.Value->Bake(OutBaked.Categories.Emplace_GetRef()); }
+	}
+
+	void FCache::Restore(const FPCGExAssetCollectionBakedCache& InBaked, TFunctionRef<const FPCGExAssetCollectionEntry*(const int32)> GetEntry)
+	{
+		WeightSum = InBaked.WeightSum;
+
+		Main->Restore(InBaked.Main, GetEntry);
+
+		Categories.Reset();
+		Categories.Reserve(InBaked.Categories.Num());
+		for (const FPCGExAssetCollectionBakedCategory& BakedCategory : InBaked.Categories)
+		{
+			PCGEX_MAKE_SHARED(Category, FCategory, BakedCategory.Name)
+			Category->Restore(BakedCategory, GetEntry);
+			Categories.Add(BakedCategory.Name, Category);
+		}
+	}
 }
 
 PCGExAssetCollection::FCache* UPCGExAssetCollection::LoadCache()
@@ -276,14 +334,27 @@ void UPCGExAssetCollection::PostDuplicate(bool bDuplicateForPIE)
 void UPCGExAssetCollection::PostEditImport()
 {
 	Super::PostEditImport();
+	BakedCache = FPCGExAssetCollectionBakedCache();
 #if WITH_EDITOR
 	EDITOR_RefreshDisplayNames();
 	EDITOR_SetDirty();
 #endif
 }
 
+void UPCGExAssetCollection::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	// Rebuild the cache from scratch & bake it so it gets serialized along with the collection
+	BakedCache = FPCGExAssetCollectionBakedCache();
+	InvalidateCache();
+
+	if (const PCGExAssetCollection::FCache* FreshCache = LoadCache()) { FreshCache->Bake(BakedCache, GetEntriesHash()); }
+
+	Super::PreSave(ObjectSaveContext);
+}
+
 void UPCGExAssetCollection::RebuildStagingData(const bool bRecursive)
 {
+	BakedCache = FPCGExAssetCollectionBakedCache();
 	InvalidateCache();
 }
 
@@ -292,6 +363,8 @@ void UPCGExAssetCollection::PostEditChangeProperty(FPropertyChangedEvent& Proper
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 
+	BakedCache = FPCGExAssetCollectionBakedCache();
+
 	EDITOR_RefreshDisplayNames();
 	EDITOR_SetDirty();
 
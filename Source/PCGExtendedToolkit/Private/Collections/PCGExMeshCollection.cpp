@@ -85,6 +85,13 @@ bool FPCGExMeshCollectionEntry::Validate(const UPCGExAssetCollection* ParentColl
 	return Super::Validate(ParentCollection);
 }
 
+uint32 FPCGExMeshCollectionEntry::GetCacheHash() const
+{
+	const bool bHasSubCollection = SubCollection != nullptr;
+	const bool bHasAsset = StaticMesh.ToSoftObjectPath().IsValid();
+	return HashCombine(Super::GetCacheHash(), HashCombine(GetTypeHash(bHasSubCollection), GetTypeHash(bHasAsset)));
+}
+
 #if WITH_EDITOR
 void FPCGExMeshCollectionEntry::EDITOR_Sanitize()
 {
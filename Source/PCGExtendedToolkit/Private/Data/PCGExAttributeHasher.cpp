@@ -5,6 +5,20 @@
 
 namespace PCGEx
 {
+	namespace AttributeHasher
+	{
+		// Spreads hashes before summing them so the commutative combination doesn't cancel out nearby values
+		FORCEINLINE static uint32 Mix(uint32 H)
+		{
+			H ^= H >> 16;
+			H *= 0x85ebca6b;
+			H ^= H >> 13;
+			H *= 0xc2b2ae35;
+			H ^= H >> 16;
+			return H;
+		}
+	}
+
 	FAttributeHasher::FAttributeHasher(const FPCGExAttributeHashConfig& InConfig)
 		: Config(InConfig)
 	{
@@ -42,11 +56,7 @@ namespace PCGEx
 		}
 		else
 		{
-			UniqueValues.Reserve(NumValues);
-			UniqueIndices.Reserve(NumValues);
-
 			Values.SetNumUninitialized(NumValues);
-			CombinedHashUnique = OutHash;
 		}
 
 
@@ -69,6 +79,11 @@ namespace PCGEx
 		return false;
 	}
 
+	bool FAttributeHasher::IsOrderInsensitive() const
+	{
+		return Config.Scope == EPCGExDataHashScope::All && Config.bSortInputValues && Config.bOrderInsensitive;
+	}
+
 	void FAttributeHasher::Compile(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager, PCGExMT::FSimpleCallback&& InCallback)
 	{
 		CompleteCallback = InCallback;
@@ -81,6 +96,13 @@ namespace PCGEx
 				This->OnCompilationComplete();
 			};
 
+		CompileHash->OnPrepareSubLoopsCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops)
+			{
+				PCGEX_ASYNC_THIS
+				if (This->IsOrderInsensitive()) { This->ScopedHashes.Init(0, Loops.Num()); }
+			};
+
 		CompileHash->OnSubLoopStartCallback =
 			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
 			{
@@ -94,50 +116,64 @@ namespace PCGEx
 	void FAttributeHasher::CompileScope(const PCGExMT::FScope& Scope)
 	{
 		ValuesGetter->Fetch(Values, Scope);
-		for (int i = Scope.Start; i < Scope.End; i++)
-		{
-			PCGExTypeHash H = Values[i];
-
-			OutHash = HashCombineFast(OutHash, H);
 
-			bool bAlreadySet = false;
-			UniqueValues.Add(H, &bAlreadySet);
-			if (!bAlreadySet)
-			{
-				CombinedHashUnique = HashCombineFast(CombinedHashUnique, H);
-				UniqueIndices.Add(i);
-			}
+		if (!ScopedHashes.IsEmpty())
+		{
+			uint64 PartialHash = 0;
+			for (int i = Scope.Start; i < Scope.End; i++) { PartialHash += AttributeHasher::Mix(Values[i]); }
+			ScopedHashes[Scope.LoopIndex] = PartialHash;
 		}
 	}
 
 	void FAttributeHasher::OnCompilationComplete()
 	{
-		if (Config.Scope == EPCGExDataHashScope::All)
-		{
-			if (Config.bSortInputValues)
-			{
-				OutHash = 0;
-				if (Config.Sorting == EPCGExSortDirection::Ascending) { Values.Sort([](const uint32 A, const uint32 B) { return A < B; }); }
-				else { Values.Sort([](const uint32 A, const uint32 B) { return A > B; }); }
+		OutHash = 0;
 
-				for (const uint32 C : Values) { OutHash = HashCombineFast(OutHash, C); }
-			}
+		if (IsOrderInsensitive())
+		{
+			uint64 Combined = 0;
+			for (const uint64 PartialHash : ScopedHashes) { Combined += PartialHash; }
+			OutHash = HashCombineFast(static_cast<uint32>(Combined), static_cast<uint32>(Combined >> 32));
 		}
-		else if (Config.Scope == EPCGExDataHashScope::Uniques)
+		else if (!Config.bSortInputValues)
 		{
-			if (!Config.bSortInputValues)
+			// Order-dependent; fold in point order
+			if (Config.Scope == EPCGExDataHashScope::All)
 			{
-				OutHash = CombinedHashUnique;
+				for (const uint32 C : Values) { OutHash = HashCombineFast(OutHash, C); }
 			}
 			else
 			{
-				OutHash = 0;
-				if (Config.Sorting == EPCGExSortDirection::Ascending) { UniqueIndices.Sort([&](const int32 A, const int32 B) { return Values[A] < Values[B]; }); }
-				else { UniqueIndices.Sort([&](const int32 A, const int32 B) { return Values[A] > Values[B]; }); }
+				TSet<PCGExTypeHash> UniqueValues;
+				UniqueValues.Reserve(NumValues);
 
-				for (const int32 Index : UniqueIndices) { OutHash = HashCombineFast(OutHash, Values[Index]); }
+				for (const uint32 C : Values)
+				{
+					bool bAlreadySet = false;
+					UniqueValues.Add(C, &bAlreadySet);
+					if (!bAlreadySet) { OutHash = HashCombineFast(OutHash, C); }
+				}
 			}
 		}
+		else
+		{
+			// Sorted; duplicates end up adjacent so uniques don't need a set
+			PCGExSorting::RadixSort(Values);
+
+			const bool bUniques = Config.Scope == EPCGExDataHashScope::Uniques;
+			auto Fold = [&](const int32 Index)
+			{
+				const uint32 C = Values[Index];
+				if (bUniques && Index > 0 && Values[Index - 1] == C) { return; }
+				OutHash = HashCombineFast(OutHash, C);
+			};
+
+			if (Config.Sorting == EPCGExSortDirection::Ascending) { for (int i = 0; i < NumValues; i++) { Fold(i); } }
+			else { for (int i = NumValues - 1; i >= 0; i--) { Fold(i); } }
+		}
+
+		Values.Empty();
+		ScopedHashes.Empty();
 
 		if (CompleteCallback) { CompleteCallback(); }
 	}
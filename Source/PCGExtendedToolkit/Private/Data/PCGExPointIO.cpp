@@ -37,6 +37,7 @@ namespace PCGExData
 		OutKeys.Reset();
 
 		bMutable = false;
+		bStreaming = false;
 
 		if (InitOut == EIOInit::None) { return true; }
 
@@ -49,6 +50,19 @@ namespace PCGExData
 
 		bMutable = true;
 
+		if (InitOut == EIOInit::Stream)
+		{
+			// Same as New, except the output is sized upfront and filled scope by scope during processing.
+			// Out metadata is parented to In, same as Duplicate; only the point copy is deferred.
+			// Points are zeroed so an output staged before being streamed never holds garbage; callers should init last.
+			check(In)
+			if (!InitializeOutput(EIOInit::New)) { return false; }
+
+			Out->GetMutablePoints().SetNumZeroed(In->GetPoints().Num());
+			bStreaming = true;
+			return true;
+		}
+
 		if (InitOut == EIOInit::New)
 		{
 			if (In)
@@ -86,6 +100,13 @@ namespace PCGExData
 		return true;
 	}
 
+	void FPointIO::StreamRange(const int32 Start, const int32 Count) const
+	{
+		check(bStreaming)
+		check(Start >= 0 && Start + Count <= In->GetPoints().Num())
+		FMemory::Memcpy(Out->GetMutablePoints().GetData() + Start, In->GetPoints().GetData() + Start, Count * sizeof(FPCGPoint));
+	}
+
 	TSharedPtr<FPCGAttributeAccessorKeysPoints> FPointIO::GetInKeys()
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FPointIO::GetInKeys);
@@ -465,4 +465,34 @@ namespace PCGExGeo
 		const FVector Dir = Hand * W1 + OtherHand * W2;
 		return Center + (Dir * Radius);
 	}
+
+	void FindOverlappingPairs(const TArray<FBox>& InBoxes, TArray<uint64>& OutPairs)
+	{
+		OutPairs.Reset();
+
+		TArray<int32> Order;
+		Order.Reserve(InBoxes.Num());
+		for (int i = 0; i < InBoxes.Num(); i++) { if (InBoxes[i].IsValid) { Order.Add(i); } }
+
+		Order.Sort([&](const int32 A, const int32 B) { return InBoxes[A].Min.X < InBoxes[B].Min.X; });
+
+		for (int i = 0; i < Order.Num(); i++)
+		{
+			const int32 A = Order[i];
+			const FBox& BoxA = InBoxes[A];
+
+			for (int j = i + 1; j < Order.Num(); j++)
+			{
+				const int32 B = Order[j];
+				const FBox& BoxB = InBoxes[B];
+
+				if (BoxB.Min.X > BoxA.Max.X) { break; } // Sorted along X, nothing further can overlap
+				if (!BoxA.Intersect(BoxB)) { continue; }
+
+				OutPairs.Add(A < B ? PCGEx::H64(A, B) : PCGEx::H64(B, A));
+			}
+		}
+
+		OutPairs.Sort();
+	}
 }
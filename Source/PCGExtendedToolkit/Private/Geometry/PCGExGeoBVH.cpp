@@ -0,0 +1,69 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Geometry/PCGExGeoBVH.h"
+
+namespace PCGExGeo
+{
+	void FBoxBVH::Build(const TArray<FBox>& InBoxes, const int32 LeafSize)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FBoxBVH::Build);
+
+		Nodes.Reset();
+		Boxes = InBoxes;
+
+		const int32 NumBoxes = Boxes.Num();
+		if (!NumBoxes) { return; }
+
+		TArray<FVector> Centers;
+		Centers.SetNumUninitialized(NumBoxes);
+		Items.SetNumUninitialized(NumBoxes);
+
+		for (int i = 0; i < NumBoxes; i++)
+		{
+			Items[i] = i;
+			Centers[i] = Boxes[i].GetCenter();
+		}
+
+		const int32 SafeLeafSize = FMath::Max(1, LeafSize);
+		Nodes.Reserve(2 * (NumBoxes / SafeLeafSize) + 1);
+		Nodes.AddDefaulted();
+		BuildNode(0, 0, NumBoxes, SafeLeafSize, Centers);
+		Nodes.Shrink();
+	}
+
+	void FBoxBVH::BuildNode(const int32 NodeIndex, const int32 Start, const int32 Count, const int32 LeafSize, const TArray<FVector>& Centers)
+	{
+		FBox Bounds = FBox(ForceInit);
+		FBox CenterBounds = FBox(ForceInit);
+
+		for (int i = Start; i < Start + Count; i++)
+		{
+			Bounds += Boxes[Items[i]];
+			CenterBounds += Centers[Items[i]];
+		}
+
+		Nodes[NodeIndex].Bounds = Bounds;
+
+		const FVector Size = CenterBounds.GetSize();
+		if (Count <= LeafSize || Size.IsNearlyZero())
+		{
+			Nodes[NodeIndex].Start = Start;
+			Nodes[NodeIndex].Count = Count;
+			return;
+		}
+
+		// Median split along the widest centroid axis
+		const int32 Axis = Size.X >= Size.Y && Size.X >= Size.Z ? 0 : Size.Y >= Size.Z ? 1 : 2;
+		MakeArrayView(Items.GetData() + Start, Count).Sort([&](const int32 A, const int32 B) { return Centers[A][Axis] < Centers[B][Axis]; });
+
+		const int32 Half = Count / 2;
+		const int32 Children = Nodes.AddDefaulted(2);
+
+		Nodes[NodeIndex].Start = Children;
+		Nodes[NodeIndex].Count = 0;
+
+		BuildNode(Children, Start, Half, LeafSize, Centers);
+		BuildNode(Children + 1, Start + Half, Count - Half, LeafSize, Centers);
+	}
+}
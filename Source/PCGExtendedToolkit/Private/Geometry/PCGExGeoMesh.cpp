@@ -0,0 +1,254 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Geometry/PCGExGeoMesh.h"
+
+#include "Engine/StaticMesh.h"
+#include "StaticMeshResources.h"
+#include "UObject/ObjectKey.h"
+
+namespace PCGExGeo
+{
+	namespace MeshTopologyCache
+	{
+		struct FEntry
+		{
+			const FStaticMeshRenderData* RenderData = nullptr; // Detect mesh rebuilds
+			TSharedPtr<const FMeshTopology> Topology;
+			uint64 Serial = 0; // Insertion order, oldest entries are evicted first
+		};
+
+		using FKey = TTuple<TObjectKey<UStaticMesh>, int32, EPCGExTriangulationType>;
+
+		constexpr int32 MaxEntries = 64;
+
+		FRWLock Lock;
+		TMap<FKey, FEntry> Entries;
+		uint64 NextSerial = 0;
+	}
+
+	TSharedPtr<const FMeshTopology> FindCachedMeshTopology(const UStaticMesh* InStaticMesh, const int32 InLODIndex, const EPCGExTriangulationType InType)
+	{
+		if (!InStaticMesh) { return nullptr; }
+
+		FReadScopeLock ReadScopeLock(MeshTopologyCache::Lock);
+		const MeshTopologyCache::FEntry* Entry = MeshTopologyCache::Entries.Find(MeshTopologyCache::FKey(InStaticMesh, InLODIndex, InType));
+		if (!Entry || Entry->RenderData != InStaticMesh->GetRenderData()) { return nullptr; }
+		return Entry->Topology;
+	}
+
+	void CacheMeshTopology(const UStaticMesh* InStaticMesh, const int32 InLODIndex, const EPCGExTriangulationType InType, const TSharedPtr<const FMeshTopology>& InTopology)
+	{
+		if (!InStaticMesh || !InTopology) { return; }
+
+		FWriteScopeLock WriteScopeLock(MeshTopologyCache::Lock);
+
+		// Drop entries whose mesh is gone before adding new ones
+		for (auto It = MeshTopologyCache::Entries.CreateIterator(); It; ++It) { if (!It.Key().Get<0>().ResolveObjectPtr()) { It.RemoveCurrent(); } }
+
+		const MeshTopologyCache::FKey Key(InStaticMesh, InLODIndex, InType);
+
+		// Evict the oldest entries to keep the cache bounded; consumers still holding a topology keep it alive
+		while (MeshTopologyCache::Entries.Num() >= MeshTopologyCache::MaxEntries && !MeshTopologyCache::Entries.Contains(Key))
+		{
+			const MeshTopologyCache::FKey* Oldest = nullptr;
+			uint64 OldestSerial = MAX_uint64;
+			for (const TPair<MeshTopologyCache::FKey, MeshTopologyCache::FEntry>& Pair : MeshTopologyCache::Entries)
+			{
+				if (Pair.Value.Serial < OldestSerial)
+				{
+					OldestSerial = Pair.Value.Serial;
+					Oldest = &Pair.Key;
+				}
+			}
+
+			MeshTopologyCache::Entries.Remove(MeshTopologyCache::FKey(*Oldest));
+		}
+
+		MeshTopologyCache::FEntry& Entry = MeshTopologyCache::Entries.FindOrAdd(Key);
+		Entry.RenderData = InStaticMesh->GetRenderData();
+		Entry.Topology = InTopology;
+		Entry.Serial = MeshTopologyCache::NextSerial++;
+	}
+
+	void FlushMeshTopologyCache()
+	{
+		FWriteScopeLock WriteScopeLock(MeshTopologyCache::Lock);
+		MeshTopologyCache::Entries.Empty();
+	}
+
+	namespace MeshTopology
+	{
+		// Welds vertices by position and returns a compact index per index buffer entry, in order of first appearance
+		static void WeldIndices(
+			const FPositionVertexBuffer& VertexBuffer,
+			const FIndexArrayView& Indices,
+			const FVector& CWTolerance,
+			TArray<int32>& OutIndices,
+			TArray<FVector>& OutVertices)
+		{
+			const int32 NumVertices = VertexBuffer.GetNumVertices();
+
+			// One hash lookup per buffer vertex, not per index
+			TArray<int32> Canonical;
+			PCGEx::InitArray(Canonical, NumVertices);
+
+			{
+				TMap<uint32, int32> PositionMap;
+				PositionMap.Reserve(NumVertices);
+				for (int i = 0; i < NumVertices; i++) { Canonical[i] = PositionMap.FindOrAdd(PCGEx::GH3(VertexBuffer.VertexPosition(i), CWTolerance), i); }
+			}
+
+			TArray<int32> Compact;
+			Compact.Init(-1, NumVertices);
+
+			PCGEx::InitArray(OutIndices, Indices.Num());
+			OutVertices.Reset(NumVertices);
+
+			for (int i = 0; i < Indices.Num(); i++)
+			{
+				const int32 C = Canonical[Indices[i]];
+				int32& Index = Compact[C];
+				if (Index == -1) { Index = OutVertices.Add(FVector(VertexBuffer.VertexPosition(C))); }
+				OutIndices[i] = Index;
+			}
+
+			OutVertices.Shrink();
+		}
+
+		static void AddTriangleEdges(TArray<uint64>& OutEdges, const int32 A, const int32 B, const int32 C)
+		{
+			if (A != B) { OutEdges.Add(PCGEx::H64U(A, B)); }
+			if (B != C) { OutEdges.Add(PCGEx::H64U(B, C)); }
+			if (C != A) { OutEdges.Add(PCGEx::H64U(C, A)); }
+		}
+
+		static void SortUnique(TArray<uint64>& OutEdges)
+		{
+			OutEdges.Sort();
+			OutEdges.SetNum(Algo::Unique(OutEdges));
+		}
+	}
+
+	void FGeoStaticMesh::ExtractMeshSynchronous()
+	{
+		if (bIsLoaded) { return; }
+		if (!bIsValid) { return; }
+
+		const FStaticMeshLODResources& LODResources = StaticMesh->GetRenderData()->LODResources[LODIndex];
+		const FPositionVertexBuffer& VertexBuffer = LODResources.VertexBuffers.PositionVertexBuffer;
+		const FIndexArrayView& Indices = LODResources.IndexBuffer.GetArrayView();
+
+		TArray<int32> Welded;
+		MeshTopology::WeldIndices(VertexBuffer, Indices, CWTolerance, Welded, Vertices);
+
+		Edges.Reset(Welded.Num());
+		for (int i = 0; i < Welded.Num(); i += 3) { MeshTopology::AddTriangleEdges(Edges, Welded[i], Welded[i + 1], Welded[i + 2]); }
+		MeshTopology::SortUnique(Edges);
+
+		bIsLoaded = true;
+	}
+
+	void FGeoStaticMesh::TriangulateMeshSynchronous()
+	{
+		if (bIsLoaded) { return; }
+		if (!bIsValid) { return; }
+
+		const FStaticMeshLODResources& LODResources = StaticMesh->GetRenderData()->LODResources[LODIndex];
+		const FPositionVertexBuffer& VertexBuffer = LODResources.VertexBuffers.PositionVertexBuffer;
+		const FIndexArrayView& Indices = LODResources.IndexBuffer.GetArrayView();
+
+		TArray<int32> Welded;
+		MeshTopology::WeldIndices(VertexBuffer, Indices, CWTolerance, Welded, Vertices);
+
+		const int32 NumTriangles = Welded.Num() / 3;
+		PCGEx::InitArray(Triangles, NumTriangles);
+
+		// Flat (edge, triangle) table; sorting groups triangles sharing an edge, in ascending triangle order
+		TArray<TTuple<uint64, int32>> EdgeTriangles;
+		PCGEx::InitArray(EdgeTriangles, NumTriangles * 3);
+
+		for (int t = 0; t < NumTriangles; t++)
+		{
+			const int32 A = Welded[t * 3];
+			const int32 B = Welded[t * 3 + 1];
+			const int32 C = Welded[t * 3 + 2];
+
+			Triangles[t] = FIntVector3(A, B, C);
+			EdgeTriangles[t * 3] = MakeTuple(PCGEx::H64U(A, B), t);
+			EdgeTriangles[t * 3 + 1] = MakeTuple(PCGEx::H64U(B, C), t);
+			EdgeTriangles[t * 3 + 2] = MakeTuple(PCGEx::H64U(A, C), t);
+		}
+
+		EdgeTriangles.Sort([](const TTuple<uint64, int32>& L, const TTuple<uint64, int32>& R) { return L.Get<0>() == R.Get<0>() ? L.Get<1>() < R.Get<1>() : L.Get<0>() < R.Get<0>(); });
+
+		Edges.Reset(EdgeTriangles.Num());
+		PCGEx::InitArray(Adjacencies, NumTriangles);
+		for (FIntVector3& Adjacency : Adjacencies) { Adjacency = FIntVector3(-1); }
+
+		int32 RunStart = 0;
+		while (RunStart < EdgeTriangles.Num())
+		{
+			const uint64 Edge = EdgeTriangles[RunStart].Get<0>();
+
+			int32 RunEnd = RunStart + 1;
+			while (RunEnd < EdgeTriangles.Num() && EdgeTriangles[RunEnd].Get<0>() == Edge) { RunEnd++; }
+
+			if (PCGEx::H64A(Edge) != PCGEx::H64B(Edge)) { Edges.Add(Edge); }
+
+			// Neighbor is the last triangle registered on that edge, or the one before it for the last triangle itself
+			const int32 Last = EdgeTriangles[RunEnd - 1].Get<1>();
+			const int32 BeforeLast = RunEnd - RunStart > 1 ? EdgeTriangles[RunEnd - 2].Get<1>() : -1;
+
+			for (int i = RunStart; i < RunEnd; i++)
+			{
+				const int32 t = EdgeTriangles[i].Get<1>();
+				const int32 Neighbor = t == Last ? BeforeLast : Last;
+				const FIntVector3& Triangle = Triangles[t];
+
+				if (Edge == PCGEx::H64U(Triangle.X, Triangle.Y)) { Adjacencies[t].X = Neighbor; }
+				else if (Edge == PCGEx::H64U(Triangle.Y, Triangle.Z)) { Adjacencies[t].Y = Neighbor; }
+				else { Adjacencies[t].Z = Neighbor; }
+			}
+
+			RunStart = RunEnd;
+		}
+
+		bIsLoaded = true;
+	}
+
+	void FGeoStaticMesh::ExtractTopologySynchronous()
+	{
+		if (bIsLoaded) { return; }
+		if (!bIsValid) { return; }
+
+		if (const TSharedPtr<const FMeshTopology> Cached = FindCachedMeshTopology(StaticMesh, LODIndex, DesiredTriangulationType))
+		{
+			Topology = Cached;
+			bIsLoaded = true;
+			return;
+		}
+
+		switch (DesiredTriangulationType)
+		{
+		default: ;
+		case EPCGExTriangulationType::Raw:
+			ExtractMeshSynchronous();
+			break;
+		case EPCGExTriangulationType::Dual:
+			TriangulateMeshSynchronous();
+			MakeDual();
+			break;
+		case EPCGExTriangulationType::Hollow:
+			TriangulateMeshSynchronous();
+			MakeHollowDual();
+			break;
+		}
+
+		PCGEX_MAKE_SHARED(NewTopology, FMeshTopology)
+		NewTopology->Vertices = MoveTemp(Vertices);
+		NewTopology->Edges = MoveTemp(Edges);
+		Topology = NewTopology;
+		CacheMeshTopology(StaticMesh, LODIndex, DesiredTriangulationType, Topology);
+	}
+}
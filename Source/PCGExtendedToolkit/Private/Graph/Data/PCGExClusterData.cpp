@@ -67,6 +67,7 @@ TSharedPtr<PCGExCluster::FCluster> PCGExClusterData::TryGetCachedCluster(const T
 				// Cheap validation -- if there are artifact use SanitizeCluster node, it's still incredibly cheaper.
 				if (CachedCluster->IsValidWith(VtxIO, EdgeIO))
 				{
+					CachedCluster->ExpandInstance();
 					return CachedCluster;
 				}
 			}
@@ -10,21 +10,15 @@ namespace PCGExCluster
 	{
 		UniqueHash = 0;
 
-		if (Links.Num() <= 1)
+		if (Links.Num() <= 1 && !bIsClosedLoop)
 		{
 			SingleEdge = Seed.Edge;
 			UniqueHash = SingleEdge;
 			return;
 		}
 
-		TArray<int32> HashValues;
-		HashValues.Reserve(Links.Num() + 1);
-		for (const FLink& Lk : Links) { HashValues.Add(Lk.Edge); }
-		HashValues.Add(Seed.Edge);
-
-		HashValues.Sort();
-
-		for (const int32 H : HashValues) { UniqueHash = HashCombineFast(UniqueHash, GetTypeHash(H)); }
+		// Edges are owned by a single chain, so both ends are enough to identify it regardless of direction
+		UniqueHash = PCGEx::H64U(Links[0].Edge, bIsClosedLoop ? Seed.Edge : Links.Last().Edge);
 	}
 
 	void FNodeChain::BuildChain(const TSharedRef<FCluster>& Cluster, const TSharedPtr<TArray<int8>>& Breakpoints)
@@ -36,39 +30,34 @@ namespace PCGExCluster
 			FixUniqueHash();
 		};
 
-		TSet<int32> Visited;
+		// Walking from a chain end only ever crosses binary nodes, so the only node that can
+		// be reached twice is the seed itself -- no need to track visited nodes.
+		const int32 MaxLinks = Cluster->Edges->Num();
 
-		FLink Last = Seed;
 		FNode* FromNode = Cluster->GetEdgeOtherNode(Seed);
 		Links.Add(FLink(FromNode->Index, Seed.Edge));
 
-		Visited.Add(Seed.Node);
-		Visited.Add(Links.Last().Node);
-
 		while (FromNode)
 		{
-			if (FromNode->IsLeaf() ||
-				FromNode->IsComplex() ||
+			if (!FromNode->IsBinary() ||
 				(Breakpoints && (*Breakpoints)[FromNode->PointIndex]))
 			{
 				bIsClosedLoop = false;
 				break;
 			}
 
-			FLink NextLink = FromNode->Links[0];                               // Get next node
-			if (NextLink.Node == Last.Node) { NextLink = FromNode->Links[1]; } // Get other next
+			const int32 FromEdge = Links.Last().Edge;
 
-			bool bAlreadyVisited = false;
-			Visited.Add(NextLink.Node, &bAlreadyVisited);
+			FLink NextLink = FromNode->Links[0];                               // Get next node
+			if (NextLink.Edge == FromEdge) { NextLink = FromNode->Links[1]; } // Get other next
 
-			if (bAlreadyVisited || NextLink.Node == Seed.Node)
+			if (NextLink.Node == Seed.Node || Links.Num() >= MaxLinks)
 			{
 				Seed.Edge = NextLink.Edge; // !
 				bIsClosedLoop = true;
 				break;
 			}
 
-			Last = Links.Last();
 			Links.Add(NextLink);
 
 			FromNode = Cluster->GetNode(NextLink.Node);
@@ -149,6 +138,7 @@ namespace PCGExCluster
 
 	bool FNodeChainBuilder::Compile(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager)
 	{
+		bLeavesOnly = false;
 		Chains.Reserve(Cluster->Edges->Num());
 		int32 NumBinaries = 0;
 
@@ -160,27 +150,34 @@ namespace PCGExCluster
 			if (Node->IsEmpty()) { continue; }
 			if (Node->IsLeaf())
 			{
+				const FNode* OtherNode = Cluster->GetNode(Node->Links[0].Node);
+
+				// Leaf-to-leaf/break single edge, only seed it from the first end
+				if (IsChainEnd(*OtherNode) && OtherNode->IsLeaf() && OtherNode->Index < Node->Index) { continue; }
+
 				PCGEX_MAKE_SHARED(NewChain, FNodeChain, FLink(Node->Index, Node->Links[0].Edge))
 				Chains.Add(NewChain);
 				continue;
 			}
 
-			if (Node->IsBinary())
+			if (!IsChainEnd(*Node))
 			{
 				NumBinaries++;
 				continue;
 			}
-			if (Breakpoints && !(*Breakpoints)[Node->PointIndex])
 
+			for (const FLink& Lk : Node->Links)
 			{
-				for (const FLink& Lk : Node->Links)
-				{
-					// Skip immediately known leaves or already seeded nodes. Avoid double-sampling simple cases
-					if (Cluster->GetNode(Lk.Node)->IsLeaf()) { continue; }
+				const FNode* OtherNode = Cluster->GetNode(Lk.Node);
 
-					PCGEX_MAKE_SHARED(NewChain, FNodeChain, FLink(Node->Index, Lk.Edge))
-					Chains.Add(NewChain);
-				}
+				// Skip immediately known leaves, they seed that edge themselves
+				if (OtherNode->IsLeaf()) { continue; }
+
+				// Single edge between two chain ends, only seed it from the first end
+				if (IsChainEnd(*OtherNode) && OtherNode->Index < Node->Index) { continue; }
+
+				PCGEX_MAKE_SHARED(NewChain, FNodeChain, FLink(Node->Index, Lk.Edge))
+				Chains.Add(NewChain);
 			}
 		}
 
@@ -203,6 +200,7 @@ namespace PCGExCluster
 
 	bool FNodeChainBuilder::CompileLeavesOnly(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager)
 	{
+		bLeavesOnly = true;
 		Chains.Reserve(Cluster->Edges->Num());
 
 		for (int i = 0; i < Cluster->Nodes->Num(); i++)
@@ -211,6 +209,13 @@ namespace PCGExCluster
 			ensure(!Node->IsEmpty());
 			if (!Node->IsLeaf() || Node->IsEmpty()) { continue; }
 
+			// Two-node cluster, only seed it from the first end
+			if (const FNode* OtherNode = Cluster->GetNode(Node->Links[0].Node);
+				OtherNode->IsLeaf() && OtherNode->Index < Node->Index)
+			{
+				continue;
+			}
+
 			PCGEX_MAKE_SHARED(NewChain, FNodeChain, FLink(Node->Index, Node->Links[0].Edge))
 			Chains.Add(NewChain);
 		}
@@ -224,38 +229,47 @@ namespace PCGExCluster
 	{
 		PCGEX_ASYNC_GROUP_CHKD(AsyncManager, ChainSearchTask)
 
-		ChainSearchTask->OnCompleteCallback =
-			[PCGEX_ASYNC_THIS_CAPTURE]()
-			{
-				PCGEX_ASYNC_THIS
-				This->Dedupe();
-			};
-
 		ChainSearchTask->OnIterationCallback =
 			[PCGEX_ASYNC_THIS_CAPTURE]
 			(const int32 Index, const PCGExMT::FScope& Scope)
 			{
 				PCGEX_ASYNC_THIS
-				This->Chains[Index]->BuildChain(This->Cluster, This->Breakpoints);
+				TSharedPtr<FNodeChain>& Chain = This->Chains[Index];
+				Chain->BuildChain(This->Cluster, This->Breakpoints);
+				if (!This->IsChainOwner(*Chain)) { Chain = nullptr; }
 			};
 
 		ChainSearchTask->StartIterations(Chains.Num(), 64, false);
 		return true;
 	}
 
-	void FNodeChainBuilder::Dedupe()
+	bool FNodeChainBuilder::IsChainOwner(const FNodeChain& Chain) const
 	{
-		TSet<uint64> UniqueHashSet;
-		UniqueHashSet.Reserve(Chains.Num());
+		// Chains are seeded in (node, link) order; when the opposite end seeded the same chain,
+		// the seed that comes first wins. Same outcome as keeping the first of duplicate chains.
 
-		for (int i = 0; i < Chains.Num(); i++)
+		auto LinkPosition = [](const FNode* Node, const int32 Edge)
 		{
-			const TSharedPtr<FNodeChain>& Chain = Chains[i];
+			for (int i = 0; i < Node->Links.Num(); i++) { if (Node->Links[i].Edge == Edge) { return i; } }
+			return -1;
+		};
 
-			bool bAlreadySet = false;
-			UniqueHashSet.Add(Chain->UniqueHash, &bAlreadySet);
+		const FNode* SeedNode = Cluster->GetNode(Chain.Seed.Node);
+		const int32 FirstEdge = Chain.Links[0].Edge;
 
-			if (bAlreadySet) { Chains[i] = nullptr; }
+		if (Chain.bIsClosedLoop)
+		{
+			// Isolated loop, or loop coming back to its seed from the other side
+			if (!IsChainEnd(*SeedNode)) { return true; }
+			return LinkPosition(SeedNode, FirstEdge) < LinkPosition(SeedNode, Chain.Seed.Edge);
 		}
+
+		if (Chain.Links.Num() == 1) { return true; } // Single edges are seeded once
+
+		const FNode* EndNode = Cluster->GetNode(Chain.Links.Last().Node);
+		if (bLeavesOnly && !EndNode->IsLeaf()) { return true; } // Other end wasn't seeded
+		if (EndNode->Index != SeedNode->Index) { return SeedNode->Index < EndNode->Index; }
+
+		return LinkPosition(SeedNode, FirstEdge) < LinkPosition(EndNode, Chain.Links.Last().Edge);
 	}
 }
@@ -5,6 +5,7 @@
 #include "Data/PCGExAttributeHelpers.h"
 #include "Geometry/PCGExGeo.h"
 #include "Graph/Data/PCGExClusterData.h"
+#include "Graph/Pathfinding/Search/PCGExScoredQueue.h"
 
 #pragma region UPCGExNodeStateDefinition
 
@@ -107,6 +108,7 @@ namespace PCGExCluster
 		Bounds = OriginalCluster->Bounds;
 
 		BoundedEdges = OriginalCluster->BoundedEdges;
+		bSharesOriginalPositions = OriginalCluster->VtxPoints == VtxPoints;
 
 		if (bCopyNodes)
 		{
@@ -162,6 +164,28 @@ namespace PCGExCluster
 		}
 	}
 
+	FCluster::FCluster(const TSharedRef<FCluster>& OtherCluster,
+	                   const TSharedPtr<PCGExData::FPointIO>& InVtxIO,
+	                   const TSharedPtr<PCGExData::FPointIO>& InEdgesIO):
+		NodeIndexLookup(OtherCluster->NodeIndexLookup), VtxIO(InVtxIO), EdgesIO(InEdgesIO)
+	{
+		// Copies are already transformed, positions will be read from what downstream sees as input
+		VtxPoints = &InVtxIO->GetPoints(PCGExData::ESource::Out);
+
+		bIsMirror = true;
+		bIsInstance = true;
+		OriginalCluster = OtherCluster;
+
+		bIsOneToOne = OtherCluster->bIsOneToOne;
+		NumRawVtx = InVtxIO->GetNum(PCGExData::ESource::Out);
+		NumRawEdges = InEdgesIO->GetNum(PCGExData::ESource::Out);
+
+		Nodes = OriginalCluster->Nodes;
+		Edges = OriginalCluster->Edges;
+
+		Bounds = FBox(ForceInit);
+	}
+
 	void FCluster::ClearInheritedForChanges(const bool bClearOwned)
 	{
 		WillModifyVtxIO(bClearOwned);
@@ -177,6 +201,8 @@ namespace PCGExCluster
 		NodeOctree.Reset();
 		EdgeOctree.Reset();
 		BoundedEdges.Reset();
+		Landmarks.Reset();
+		bSharesOriginalPositions = false;
 	}
 
 	FCluster::~FCluster()
@@ -185,7 +211,7 @@ namespace PCGExCluster
 	}
 
 	bool FCluster::BuildFrom(
-		const TMap<uint32, int32>& InEndpointsLookup,
+		const PCGExGraph::FEndpointsLookup& InEndpointsLookup,
 		const TArray<int32>* InExpectedAdjacency,
 		const PCGExData::ESource PointsSource)
 	{
@@ -228,18 +254,18 @@ namespace PCGExCluster
 			uint32 B;
 			PCGEx::H64(Endpoints[i], A, B);
 
-			const int32* StartPointIndexPtr = InEndpointsLookup.Find(A);
-			const int32* EndPointIndexPtr = InEndpointsLookup.Find(B);
+			const int32 StartPointIndex = InEndpointsLookup.Find(A);
+			const int32 EndPointIndex = InEndpointsLookup.Find(B);
 
-			if ((!StartPointIndexPtr || !EndPointIndexPtr || *StartPointIndexPtr == *EndPointIndexPtr)) { return OnFail(); }
+			if (StartPointIndex == -1 || EndPointIndex == -1 || StartPointIndex == EndPointIndex) { return OnFail(); }
 
-			const int32 StartNode = GetOrCreateNode_Unsafe(InNodePoints, *StartPointIndexPtr);
-			const int32 EndNode = GetOrCreateNode_Unsafe(InNodePoints, *EndPointIndexPtr);
+			const int32 StartNode = GetOrCreateNode_Unsafe(InNodePoints, StartPointIndex);
+			const int32 EndNode = GetOrCreateNode_Unsafe(InNodePoints, EndPointIndex);
 
 			(Nodes->GetData() + StartNode)->Link(EndNode, i);
 			(Nodes->GetData() + EndNode)->Link(StartNode, i);
 
-			*(Edges->GetData() + i) = FEdge(i, *StartPointIndexPtr, *EndPointIndexPtr, i, EdgeIOIndex);
+			*(Edges->GetData() + i) = FEdge(i, StartPointIndex, EndPointIndex, i, EdgeIOIndex);
 		}
 
 		if (InExpectedAdjacency)
@@ -292,6 +318,22 @@ namespace PCGExCluster
 		Bounds = Bounds.ExpandBy(10);
 	}
 
+	void FCluster::ExpandInstance()
+	{
+		{
+			FReadScopeLock ReadScopeLock(ClusterLock);
+			if (!bIsInstance) { return; }
+		}
+		{
+			FWriteScopeLock WriteScopeLock(ClusterLock);
+			if (!bIsInstance) { return; }
+
+			UpdatePositions();
+			Bounds = Bounds.ExpandBy(10);
+			bIsInstance = false;
+		}
+	}
+
 	bool FCluster::IsValidWith(const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO) const
 	{
 		return NumRawVtx == InVtxIO->GetNum() && NumRawEdges == InEdgesIO->GetNum();
@@ -703,6 +745,35 @@ namespace PCGExCluster
 		return BoundedEdges;
 	}
 
+	TSharedPtr<FLandmarks> FCluster::GetLandmarks(const int32 NumLandmarks)
+	{
+		const int32 NumWanted = FMath::Min(NumLandmarks, Nodes->Num());
+
+		{
+			FReadScopeLock ReadScopeLock(ClusterLock);
+			if (Landmarks && Landmarks->Num() >= NumWanted) { return Landmarks; }
+		}
+
+		if (bIsMirror && bSharesOriginalPositions)
+		{
+			// Build on (or fetch from) the original cluster, which is the one bound to the edge data and cached across executions
+			TSharedPtr<FLandmarks> SharedLandmarks = OriginalCluster->GetLandmarks(NumLandmarks);
+
+			FWriteScopeLock WriteScopeLock(ClusterLock);
+			Landmarks = SharedLandmarks;
+			return SharedLandmarks;
+		}
+
+		FWriteScopeLock WriteScopeLock(ClusterLock);
+		if (Landmarks && Landmarks->Num() >= NumWanted) { return Landmarks; }
+
+		PCGEX_MAKE_SHARED(NewLandmarks, FLandmarks)
+		NewLandmarks->Build(this, NumWanted);
+		Landmarks = NewLandmarks;
+
+		return NewLandmarks;
+	}
+
 	void FCluster::ExpandEdges(PCGExMT::FTaskManager* AsyncManager)
 	{
 		if (BoundedEdges) { return; }
@@ -771,6 +842,75 @@ namespace PCGExCluster
 		return NodeIndex;
 	}
 
+	void FLandmarks::Build(const FCluster* InCluster, const int32 InNumLandmarks)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FLandmarks::Build);
+
+		const TArray<FNode>& NodesRef = *InCluster->Nodes;
+		const int32 NumNodes = NodesRef.Num();
+
+		Stride = FMath::Clamp(InNumLandmarks, 1, NumNodes);
+		Nodes.Reset(Stride);
+		Distances.Init(-1, NumNodes * Stride);
+
+		if (!NumNodes) { return; }
+
+		TArray<double> SourceDistances;
+
+		auto ComputeDistances = [&](const int32 Source)
+		{
+			SourceDistances.Init(-1, NumNodes);
+
+			// Scored queue rejects non-improving scores, so each node is dequeued exactly once with its final distance
+			PCGExSearch::FScoredQueue Queue(NumNodes, Source, 0);
+
+			int32 CurrentIndex;
+			double CurrentDist;
+			while (Queue.Dequeue(CurrentIndex, CurrentDist))
+			{
+				SourceDistances[CurrentIndex] = CurrentDist;
+				for (const FLink Lk : NodesRef[CurrentIndex].Links) { Queue.Enqueue(Lk.Node, CurrentDist + InCluster->GetDist(CurrentIndex, Lk.Node)); }
+			}
+		};
+
+		auto FindFarthest = [&](const TArray<double>& InDistances)
+		{
+			int32 Farthest = -1;
+			double FarthestDist = 0;
+			for (int i = 0; i < NumNodes; i++)
+			{
+				if (InDistances[i] > FarthestDist)
+				{
+					Farthest = i;
+					FarthestDist = InDistances[i];
+				}
+			}
+			return Farthest;
+		};
+
+		// Farthest-point selection; the first landmark is the node farthest from an arbitrary start
+		ComputeDistances(0);
+		int32 NextLandmark = FMath::Max(0, FindFarthest(SourceDistances));
+
+		TArray<double> MinDistances;
+		MinDistances.Init(MAX_dbl, NumNodes);
+
+		for (int l = 0; l < Stride && NextLandmark != -1; l++)
+		{
+			Nodes.Add(NextLandmark);
+			ComputeDistances(NextLandmark);
+
+			for (int i = 0; i < NumNodes; i++)
+			{
+				const double Dist = SourceDistances[i];
+				Distances[i * Stride + l] = Dist;
+				MinDistances[i] = Dist < 0 ? 0 : FMath::Min(MinDistances[i], Dist);
+			}
+
+			NextLandmark = FindFarthest(MinDistances);
+		}
+	}
+
 	void GetAdjacencyData(const FCluster* InCluster, FNode& InNode, TArray<FAdjacencyData>& OutData)
 	{
 		const int32 NumAdjacency = InNode.Num();
@@ -51,15 +51,8 @@ namespace PCGExClusterMT
 		bRequiresHeuristics = bRequired;
 	}
 
-	bool FClusterProcessor::Process(const TSharedPtr<PCGExMT::FTaskManager> InAsyncManager)
+	bool FClusterProcessor::BuildCluster()
 	{
-		AsyncManager = InAsyncManager;
-		PCGEX_ASYNC_CHKD(AsyncManager)
-
-		PCGEX_CHECK_WORK_PERMIT(false)
-
-		if (!bBuildCluster) { return true; }
-
 		if (const TSharedPtr<PCGExCluster::FCluster> CachedCluster = PCGExClusterData::TryGetCachedCluster(VtxDataFacade->Source, EdgeDataFacade->Source))
 		{
 			Cluster = HandleCachedCluster(CachedCluster.ToSharedRef());
@@ -81,15 +74,51 @@ namespace PCGExClusterMT
 		NumNodes = Cluster->Nodes->Num();
 		NumEdges = Cluster->Edges->Num();
 
-		if (bRequiresHeuristics)
+		return true;
+	}
+
+	bool FClusterProcessor::PrepareHeuristics(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager)
+	{
+		AsyncManager = InAsyncManager;
+		PCGEX_ASYNC_CHKD(AsyncManager)
+
+		PCGEX_CHECK_WORK_PERMIT(false)
+
+		if (!bBuildCluster) { return true; }
+		if (!BuildCluster()) { return false; }
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(FClusterProcessor::Heuristics);
+		HeuristicsHandler = MakeShared<PCGExHeuristics::FHeuristicsHandler>(ExecutionContext, VtxDataFacade, EdgeDataFacade, *HeuristicsFactories);
+
+		if (!HeuristicsHandler->IsValidHandler())
 		{
-			TRACE_CPUPROFILER_EVENT_SCOPE(FClusterProcessor::Heuristics);
-			HeuristicsHandler = MakeShared<PCGExHeuristics::FHeuristicsHandler>(ExecutionContext, VtxDataFacade, EdgeDataFacade, *HeuristicsFactories);
+			HeuristicsHandler.Reset();
+			return false;
+		}
+
+		HeuristicsHandler->PrepareForCluster(Cluster);
+		HeuristicsHandler->CompleteClusterPreparation();
 
-			if (!HeuristicsHandler->IsValidHandler()) { return false; }
+		return true;
+	}
+
+	bool FClusterProcessor::Process(const TSharedPtr<PCGExMT::FTaskManager> InAsyncManager)
+	{
+		AsyncManager = InAsyncManager;
+		PCGEX_ASYNC_CHKD(AsyncManager)
 
-			HeuristicsHandler->PrepareForCluster(Cluster);
-			HeuristicsHandler->CompleteClusterPreparation();
+		PCGEX_CHECK_WORK_PERMIT(false)
+
+		if (!bBuildCluster) { return true; }
+
+		if (bRequiresHeuristics)
+		{
+			// Cluster & heuristics were prepared ahead of processing by the batch
+			if (!Cluster || !HeuristicsHandler) { return false; }
+		}
+		else if (!BuildCluster())
+		{
+			return false;
 		}
 
 		// Building cluster may have taken a while so let's make sure we're still legit
@@ -262,18 +291,36 @@ namespace PCGExClusterMT
 
 					PCGEX_ASYNC_THIS
 
-					const int32 Num = This->VtxDataFacade->GetNum();
-					This->EndpointsLookup.Reserve(Num);
-					for (int i = 0; i < Num; i++) { This->EndpointsLookup.Add(This->ReverseLookup[i], i); }
-					This->ReverseLookup.Empty();
+					This->EndpointsLookup.Init(This->ReverseLookup);
 
-					if (This->RequiresGraphBuilder())
-					{
-						This->GraphBuilder = MakeShared<PCGExGraph::FGraphBuilder>(This->VtxDataFacade, &This->GraphBuilderDetails, 6);
-						This->GraphBuilder->SourceEdgeFacades = This->EdgesDataFacades;
-					}
+					PCGEX_ASYNC_GROUP_CHKD_VOID(This->AsyncManager, FillEndpointLookupTask)
+
+					FillEndpointLookupTask->OnCompleteCallback =
+						[AsyncThis]()
+						{
+							PCGEX_ASYNC_NESTED_THIS
+
+							NestedThis->ReverseLookup.Empty();
+
+							if (NestedThis->RequiresGraphBuilder())
+							{
+								NestedThis->GraphBuilder = MakeShared<PCGExGraph::FGraphBuilder>(NestedThis->VtxDataFacade, &NestedThis->GraphBuilderDetails, 6);
+								NestedThis->GraphBuilder->SourceEdgeFacades = NestedThis->EdgesDataFacades;
+							}
+
+							NestedThis->OnProcessingPreparationComplete();
+						};
+
+					FillEndpointLookupTask->OnSubLoopStartCallback =
+						[AsyncThis](const PCGExMT::FScope& Scope)
+						{
+							TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExGraph::BuildLookupTable::Fill);
+
+							PCGEX_ASYNC_NESTED_THIS
+							for (int i = Scope.Start; i < Scope.End; i++) { NestedThis->EndpointsLookup.Insert(NestedThis->ReverseLookup[i], i); }
+						};
 
-					This->OnProcessingPreparationComplete();
+					FillEndpointLookupTask->StartSubLoops(This->ReverseLookup.Num(), GetDefault<UPCGExGlobalSettings>()->GetClusterBatchChunkSize());
 				};
 
 			BuildEndpointLookupTask->OnSubLoopStartCallback =
@@ -293,7 +340,7 @@ namespace PCGExClusterMT
 						This->ExpectedAdjacency[i] = B;
 					}
 				};
-			BuildEndpointLookupTask->StartSubLoops(VtxDataFacade->GetNum(), 4096);
+			BuildEndpointLookupTask->StartSubLoops(VtxDataFacade->GetNum(), GetDefault<UPCGExGlobalSettings>()->GetClusterBatchChunkSize());
 		}
 	}
 
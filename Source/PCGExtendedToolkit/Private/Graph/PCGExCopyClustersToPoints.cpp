@@ -82,6 +82,9 @@ namespace PCGExCopyClusters
 
 	bool FProcessor::Process(TSharedPtr<PCGExMT::FTaskManager> InAsyncManager)
 	{
+		// Template cluster, built once (or forwarded from cache) and shared by every copy
+		bBuildCluster = Settings->bShareTopology && GetDefault<UPCGExGlobalSettings>()->bCacheClusters;
+
 		if (!FClusterProcessor::Process(InAsyncManager)) { return false; }
 
 		const TArray<FPCGPoint>& Targets = Context->TargetsDataFacade->GetIn()->GetPoints();
@@ -138,9 +141,6 @@ namespace PCGExCopyClusters
 		const TArray<FPCGPoint>& Targets = Context->TargetsDataFacade->GetIn()->GetPoints();
 		const int32 NumTargets = Targets.Num();
 
-		// Once work is complete, check if there are cached clusters we can forward
-		const TSharedPtr<PCGExCluster::FCluster> CachedCluster = PCGExClusterData::TryGetCachedCluster(VtxDataFacade->Source, EdgeDataFacade->Source);
-
 		for (int i = 0; i < NumTargets; i++)
 		{
 			TSharedPtr<PCGExData::FPointIO> EdgeDupe = EdgesDupes[i];
@@ -151,7 +151,11 @@ namespace PCGExCopyClusters
 			Context->TargetsForwardHandler->Forward(i, EdgeDupe->GetOut()->Metadata);
 		}
 
-		if (!CachedCluster) { return; }
+		if (!Cluster) { return; }
+
+		// Bind an instance of the template to each copy; topology & lookups are shared,
+		// positions are only resolved if a downstream node actually fetches the cached cluster.
+		const TSharedRef<PCGExCluster::FCluster> TemplateCluster = Cluster.ToSharedRef();
 
 		for (int i = 0; i < NumTargets; i++)
 		{
@@ -160,13 +164,9 @@ namespace PCGExCopyClusters
 
 			if (!EdgeDupe) { continue; }
 
-			UPCGExClusterEdgesData* EdgeDupeTypedData = Cast<UPCGExClusterEdgesData>(EdgeDupe->GetOut());
-			if (CachedCluster && EdgeDupeTypedData)
+			if (UPCGExClusterEdgesData* EdgeDupeTypedData = Cast<UPCGExClusterEdgesData>(EdgeDupe->GetOut()))
 			{
-				EdgeDupeTypedData->SetBoundCluster(
-					MakeShared<PCGExCluster::FCluster>(
-						CachedCluster.ToSharedRef(), VtxDupe, EdgeDupe, CachedCluster->NodeIndexLookup,
-						false, false, false));
+				EdgeDupeTypedData->SetBoundCluster(MakeShared<PCGExCluster::FCluster>(TemplateCluster, VtxDupe, EdgeDupe));
 			}
 		}
 	}
@@ -5,6 +5,90 @@
 
 namespace PCGExGraph
 {
+	void FEndpointsLookup::Init(const TArrayView<const uint32> Ids)
+	{
+		NumEndpoints = Ids.Num();
+		Slots.Reset();
+
+		if (!NumEndpoints) { return; }
+
+		uint32 Max = 0;
+		Min = MAX_uint32;
+		for (const uint32 Id : Ids)
+		{
+			Min = FMath::Min(Min, Id);
+			Max = FMath::Max(Max, Id);
+		}
+
+		// Dense when ids don't waste more than half the table
+		const uint64 Range = static_cast<uint64>(Max - Min) + 1;
+		bDense = Range <= static_cast<uint64>(NumEndpoints) * 2;
+
+		if (bDense)
+		{
+			Slots.Init(-1, static_cast<int32>(Range));
+			return;
+		}
+
+		const uint32 Capacity = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(NumEndpoints) * 2);
+		Mask = Capacity - 1;
+		Slots.Init(0, Capacity);
+	}
+
+	void FEndpointsLookup::Insert(const uint32 Id, const int32 Index)
+	{
+		int64* Data = Slots.GetData();
+
+		if (bDense)
+		{
+			int64* Slot = Data + (Id - Min);
+			int64 Current = *Slot;
+			while (Current < Index)
+			{
+				const int64 Previous = FPlatformAtomics::InterlockedCompareExchange(Slot, Index, Current);
+				if (Previous == Current) { return; }
+				Current = Previous;
+			}
+			return;
+		}
+
+		const int64 Packed = static_cast<int64>((static_cast<uint64>(Id) << 32) | static_cast<uint32>(Index + 1));
+
+		for (uint32 Slot = MurmurFinalize32(Id) & Mask;; Slot = (Slot + 1) & Mask)
+		{
+			int64 Current = Data[Slot];
+
+			while (true)
+			{
+				if (!Current)
+				{
+					// Claim the empty slot
+					const int64 Previous = FPlatformAtomics::InterlockedCompareExchange(Data + Slot, Packed, 0);
+					if (Previous == 0) { return; }
+					Current = Previous;
+					continue;
+				}
+
+				if (static_cast<uint32>(static_cast<uint64>(Current) >> 32) != Id) { break; } // Probe next slot
+
+				// Same id, keep the highest index
+				if (static_cast<int32>(static_cast<uint32>(Current)) - 1 >= Index) { return; }
+				const int64 Previous = FPlatformAtomics::InterlockedCompareExchange(Data + Slot, Packed, Current);
+				if (Previous == Current) { return; }
+				Current = Previous;
+			}
+		}
+	}
+
+	void FEndpointsLookup::Empty()
+	{
+		NumEndpoints = 0;
+		bDense = true;
+		Min = 0;
+		Mask = 0;
+		Slots.Empty();
+	}
+
 	void SetClusterVtx(const TSharedPtr<PCGExData::FPointIO>& IO, PCGExTags::IDType& OutId)
 	{
 		OutId = IO->Tags->Set<int32>(TagStr_PCGExCluster, IO->GetOutIn()->GetUniqueID());
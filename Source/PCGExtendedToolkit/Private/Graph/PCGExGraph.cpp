@@ -114,7 +114,7 @@ bool FPCGExGraphBuilderDetails::IsValid(const TSharedPtr<PCGExGraph::FSubGraph>&
 
 bool PCGExGraph::BuildIndexedEdges(
 	const TSharedPtr<PCGExData::FPointIO>& EdgeIO,
-	const TMap<uint32, int32>& EndpointsLookup,
+	const PCGExGraph::FEndpointsLookup& EndpointsLookup,
 	TArray<FEdge>& OutEdges,
 	const bool bStopOnError)
 {
@@ -141,12 +141,12 @@ bool PCGExGraph::BuildIndexedEdges(
 			uint32 B;
 			PCGEx::H64(Endpoints[i], A, B);
 
-			const int32* StartPointIndexPtr = EndpointsLookup.Find(A);
-			const int32* EndPointIndexPtr = EndpointsLookup.Find(B);
+			const int32 StartPointIndex = EndpointsLookup.Find(A);
+			const int32 EndPointIndex = EndpointsLookup.Find(B);
 
-			if ((!StartPointIndexPtr || !EndPointIndexPtr)) { continue; }
+			if (StartPointIndex == -1 || EndPointIndex == -1) { continue; }
 
-			OutEdges[EdgeIndex] = FEdge(EdgeIndex, *StartPointIndexPtr, *EndPointIndexPtr, i, EdgeIOIndex);
+			OutEdges[EdgeIndex] = FEdge(EdgeIndex, StartPointIndex, EndPointIndex, i, EdgeIOIndex);
 			EdgeIndex++;
 		}
 
@@ -160,16 +160,16 @@ bool PCGExGraph::BuildIndexedEdges(
 			uint32 B;
 			PCGEx::H64(Endpoints[i], A, B);
 
-			const int32* StartPointIndexPtr = EndpointsLookup.Find(A);
-			const int32* EndPointIndexPtr = EndpointsLookup.Find(B);
+			const int32 StartPointIndex = EndpointsLookup.Find(A);
+			const int32 EndPointIndex = EndpointsLookup.Find(B);
 
-			if ((!StartPointIndexPtr || !EndPointIndexPtr))
+			if (StartPointIndex == -1 || EndPointIndex == -1)
 			{
 				bValid = false;
 				break;
 			}
 
-			OutEdges[i] = FEdge(i, *StartPointIndexPtr, *EndPointIndexPtr, i, EdgeIOIndex);
+			OutEdges[i] = FEdge(i, StartPointIndex, EndPointIndex, i, EdgeIOIndex);
 		}
 	}
 
@@ -276,14 +276,6 @@ MACRO(Crossing, bWriteCrossing, Crossing,TEXT("bCrossing"))
 		return -1;
 	}
 
-	void FSubGraph::Add(const FEdge& Edge, FGraph* InGraph)
-	{
-		Nodes.Add(Edge.Start);
-		Nodes.Add(Edge.End);
-		Edges.Add(Edge.Index);
-		if (Edge.IOIndex >= 0) { EdgesInIOIndices.Add(Edge.IOIndex); }
-	}
-
 	void FSubGraph::Invalidate(FGraph* InGraph)
 	{
 		for (const int32 EdgeIndex : Edges) { InGraph->Edges[EdgeIndex].bValid = false; }
@@ -321,7 +313,7 @@ MACRO(Crossing, bWriteCrossing, Crossing,TEXT("bCrossing"))
 		WeakBuilder = InBuilder;
 		WeakAsyncManager = AsyncManager;
 
-		TArray<int32> EdgeDump = Edges.Array();
+		const TArray<int32>& EdgeDump = Edges;
 		const int32 NumEdges = EdgeDump.Num();
 
 		PCGEx::InitArray(FlattenedEdges, NumEdges);
@@ -749,70 +741,116 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::BuildSubGraphs);
 
-		TBitArray<> VisitedNodes;
-		TBitArray<> VisitedEdges;
-		VisitedNodes.Init(false, Nodes.Num());
-		VisitedEdges.Init(false, Edges.Num());
+		const int32 NumNodes = Nodes.Num();
+		const int32 NumEdges = Edges.Num();
+
+		// Union-find over valid edges (path halving, union by rank)
+
+		TArray<int32> Parents;
+		TArray<uint8> Ranks;
+		PCGEx::InitArray(Parents, NumNodes);
+		Ranks.Init(0, NumNodes);
+
+		for (int i = 0; i < NumNodes; i++)
+		{
+			Parents[i] = i;
+			Nodes[i].NumExportedEdges = 0;
+		}
+
+		auto FindRoot = [&](int32 Index)
+		{
+			while (Parents[Index] != Index)
+			{
+				Parents[Index] = Parents[Parents[Index]];
+				Index = Parents[Index];
+			}
+			return Index;
+		};
 
-		int32 VisitedNum = 0;
+		TBitArray<> ValidEdges;
+		ValidEdges.Init(false, NumEdges);
 
-		for (int i = 0; i < Nodes.Num(); i++)
+		for (int i = 0; i < NumEdges; i++)
 		{
-			const FNode& CurrentNode = Nodes[i];
+			const FEdge& Edge = Edges[i];
+			if (!Edge.bValid) { continue; }
 
-			if (VisitedNodes[i]) { continue; }
+			FNode& StartNode = Nodes[Edge.Start];
+			FNode& EndNode = Nodes[Edge.End];
+			if (!StartNode.bValid || !EndNode.bValid) { continue; }
 
-			VisitedNodes[i] = true;
-			VisitedNum++;
+			ValidEdges[i] = true;
+			StartNode.NumExportedEdges++;
+			EndNode.NumExportedEdges++;
 
-			if (!CurrentNode.bValid || CurrentNode.IsEmpty()) { continue; }
+			int32 A = FindRoot(Edge.Start);
+			int32 B = FindRoot(Edge.End);
+			if (A == B) { continue; }
 
-			PCGEX_MAKE_SHARED(SubGraph, FSubGraph)
-			SubGraph->WeakParentGraph = SharedThis(this);
+			if (Ranks[A] < Ranks[B]) { Swap(A, B); }
+			Parents[B] = A;
+			if (Ranks[A] == Ranks[B]) { Ranks[A]++; }
+		}
+
+		// Assign subgraph ids in node order, so subgraphs come out sorted by their lowest node index
+
+		TArray<int32> NodeSubGraph;
+		TArray<int32> RootSubGraph;
+		NodeSubGraph.Init(-1, NumNodes);
+		RootSubGraph.Init(-1, NumNodes);
+
+		TArray<int32> NodeCounts;
+		TArray<int32> EdgeCounts;
 
-			TArray<int32> Stack;
-			Stack.Reserve(Nodes.Num() - VisitedNum);
-			Stack.Add(i);
+		for (int i = 0; i < NumNodes; i++)
+		{
+			if (!Nodes[i].NumExportedEdges) { continue; }
 
-			while (Stack.Num() > 0)
+			const int32 Root = FindRoot(i);
+			int32& SubGraphIndex = RootSubGraph[Root];
+			if (SubGraphIndex == -1)
 			{
-#if PCGEX_ENGINE_VERSION <= 503
-				const int32 NextIndex = Stack.Pop(false);
-#else
-				const int32 NextIndex = Stack.Pop(EAllowShrinking::No);
-#endif
-				FNode& Node = Nodes[NextIndex];
-				Node.NumExportedEdges = 0;
-
-				for (const FLink Lk : Node.Links)
-				{
-					const int32 E = Lk.Edge;
+				SubGraphIndex = NodeCounts.Add(0);
+				EdgeCounts.Add(0);
+			}
 
-					if (VisitedEdges[E]) { continue; }
-					VisitedEdges[E] = true;
+			NodeSubGraph[i] = SubGraphIndex;
+			NodeCounts[SubGraphIndex]++;
+		}
 
-					const FEdge& Edge = Edges[E];
+		for (int i = 0; i < NumEdges; i++) { if (ValidEdges[i]) { EdgeCounts[NodeSubGraph[Edges[i].Start]]++; } }
 
-					if (!Edge.bValid) { continue; }
+		// Counting-sort scatter into flat, sorted index arrays
 
-					const int32 OtherIndex = Edge.Other(NextIndex);
-					if (!Nodes[OtherIndex].bValid) { continue; }
+		const int32 NumSubGraphs = NodeCounts.Num();
+		TArray<TSharedPtr<FSubGraph>> NewSubGraphs;
+		NewSubGraphs.Reserve(NumSubGraphs);
 
-					Node.NumExportedEdges++;
-					SubGraph->Add(Edge, this);
+		for (int i = 0; i < NumSubGraphs; i++)
+		{
+			PCGEX_MAKE_SHARED(SubGraph, FSubGraph)
+			SubGraph->WeakParentGraph = SharedThis(this);
+			SubGraph->Nodes.Reserve(NodeCounts[i]);
+			SubGraph->Edges.Reserve(EdgeCounts[i]);
+			NewSubGraphs.Add(SubGraph);
+		}
 
-					if (!VisitedNodes[OtherIndex]) // Only enqueue if not already visited
-					{
-						VisitedNodes[OtherIndex] = true;
-						VisitedNum++;
+		for (int i = 0; i < NumNodes; i++) { if (NodeSubGraph[i] != -1) { NewSubGraphs[NodeSubGraph[i]]->Nodes.Add(i); } }
+		for (int i = 0; i < NumEdges; i++)
+		{
+			if (!ValidEdges[i]) { continue; }
 
-						Stack.Add(OtherIndex);
-					}
-				}
-			}
+			const FEdge& Edge = Edges[i];
+			FSubGraph* SubGraph = NewSubGraphs[NodeSubGraph[Edge.Start]].Get();
+			SubGraph->Edges.Add(i);
+			if (Edge.IOIndex >= 0) { SubGraph->EdgesInIOIndices.Add(Edge.IOIndex); }
+		}
 
-			if (!Limits.IsValid(SubGraph)) { SubGraph->Invalidate(this); } // Will invalidate isolated points
-			else if (!SubGraph->Edges.IsEmpty()) { SubGraphs.Add(SubGraph.ToSharedRef()); }
+		SubGraphs.Reserve(SubGraphs.Num() + NumSubGraphs);
+		for (const TSharedPtr<FSubGraph>& SubGraph : NewSubGraphs)
+		{
+			if (!Limits.IsValid(SubGraph)) { SubGraph->Invalidate(this); }
+			else { SubGraphs.Add(SubGraph.ToSharedRef()); }
 		}
 	}
 
@@ -1105,7 +1143,7 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		EdgesIO->StageOutputs();
 	}
 
-	bool BuildEndpointsLookup(const TSharedPtr<PCGExData::FPointIO>& InPointIO, TMap<uint32, int32>& OutIndices, TArray<int32>& OutAdjacency)
+	bool BuildEndpointsLookup(const TSharedPtr<PCGExData::FPointIO>& InPointIO, FEndpointsLookup& OutIndices, TArray<int32>& OutAdjacency)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExGraph::BuildLookupTable);
 
@@ -1117,17 +1155,19 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 
 		const TArray<int64>& Indices = *IndexBuffer->GetInValues().Get();
 
-		OutIndices.Reserve(Indices.Num());
+		TArray<uint32> Ids;
+		PCGEx::InitArray(Ids, Indices.Num());
+
 		for (int i = 0; i < Indices.Num(); i++)
 		{
-			uint32 A;
 			uint32 B;
-			PCGEx::H64(Indices[i], A, B);
-
-			OutIndices.Add(A, i);
+			PCGEx::H64(Indices[i], Ids[i], B);
 			OutAdjacency[i] = B;
 		}
 
+		OutIndices.Init(Ids);
+		for (int i = 0; i < Ids.Num(); i++) { OutIndices.Insert(Ids[i], i); }
+
 		return true;
 	}
 
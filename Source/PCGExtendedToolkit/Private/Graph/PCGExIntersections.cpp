@@ -3,6 +3,8 @@
 
 #include "Graph/PCGExIntersections.h"
 
+#include "Algo/BinarySearch.h"
+#include "Algo/Unique.h"
 #include "PCGExPointsProcessor.h"
 #include "Graph/PCGExCluster.h"
 
@@ -365,6 +367,157 @@ namespace PCGExGraph
 		*/
 	}
 
+	namespace IntersectionGrid
+	{
+		constexpr int32 AxisBits = 21;
+		constexpr int32 AxisMax = (1 << AxisBits) - 1;
+	}
+
+	FIntersectionGrid::FIntersectionGrid(const FBox& InBounds, const double InCellSize)
+	{
+		// Keep one spare cell around the bounds, and make sure every coordinate fits the packed key
+		const double MinCellSize = InBounds.GetSize().GetMax() / static_cast<double>(IntersectionGrid::AxisMax - 4);
+		CellSize = FMath::Max3(InCellSize, MinCellSize, UE_KINDA_SMALL_NUMBER);
+		InvCellSize = 1 / CellSize;
+		Origin = InBounds.Min - FVector(CellSize * 2);
+	}
+
+	FIntVector FIntersectionGrid::GetCoords(const FVector& Position) const
+	{
+		const FVector Local = (Position - Origin) * InvCellSize;
+		return FIntVector(
+			FMath::Clamp(FMath::FloorToInt32(Local.X), 0, IntersectionGrid::AxisMax),
+			FMath::Clamp(FMath::FloorToInt32(Local.Y), 0, IntersectionGrid::AxisMax),
+			FMath::Clamp(FMath::FloorToInt32(Local.Z), 0, IntersectionGrid::AxisMax));
+	}
+
+	uint64 FIntersectionGrid::GetCell(const FIntVector& Coords)
+	{
+		return static_cast<uint64>(Coords.X) << (IntersectionGrid::AxisBits * 2) |
+			static_cast<uint64>(Coords.Y) << IntersectionGrid::AxisBits |
+			static_cast<uint64>(Coords.Z);
+	}
+
+	uint64 FIntersectionGrid::GetCell(const FVector& Position) const
+	{
+		return GetCell(GetCoords(Position));
+	}
+
+	void FIntersectionGrid::AddBox(const FVector& A, const FVector& B, const double Expansion, TArray<uint64>& OutCells) const
+	{
+		const FIntVector Min = GetCoords(A.ComponentMin(B) - FVector(Expansion));
+		const FIntVector Max = GetCoords(A.ComponentMax(B) + FVector(Expansion));
+
+		for (int32 X = Min.X; X <= Max.X; X++)
+		{
+			for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+			{
+				for (int32 Z = Min.Z; Z <= Max.Z; Z++) { OutCells.Add(GetCell(FIntVector(X, Y, Z))); }
+			}
+		}
+	}
+
+	void FIntersectionGrid::Rasterize(const FVector& A, const FVector& B, const double Expansion, TArray<uint64>& OutCells) const
+	{
+		OutCells.Reset();
+
+		const FVector Delta = B - A;
+		FIntVector Coords = GetCoords(A);
+		const FIntVector EndCoords = GetCoords(B);
+
+		FIntVector Step = FIntVector::ZeroValue;
+		FVector TMax = FVector(MAX_dbl);
+		FVector TDelta = FVector(MAX_dbl);
+
+		for (int Axis = 0; Axis < 3; Axis++)
+		{
+			if (Delta[Axis] > 0)
+			{
+				Step[Axis] = 1;
+				TMax[Axis] = (Origin[Axis] + (Coords[Axis] + 1) * CellSize - A[Axis]) / Delta[Axis];
+				TDelta[Axis] = CellSize / Delta[Axis];
+			}
+			else if (Delta[Axis] < 0)
+			{
+				Step[Axis] = -1;
+				TMax[Axis] = (Origin[Axis] + Coords[Axis] * CellSize - A[Axis]) / Delta[Axis];
+				TDelta[Axis] = -CellSize / Delta[Axis];
+			}
+		}
+
+		// Each traversed cell contributes the cells overlapped by its own portion of the segment, expanded by tolerance
+		const int32 MaxSteps = FMath::Abs(EndCoords.X - Coords.X) + FMath::Abs(EndCoords.Y - Coords.Y) + FMath::Abs(EndCoords.Z - Coords.Z);
+
+		double T0 = 0;
+		for (int32 i = 0; i <= MaxSteps; i++)
+		{
+			const int32 Axis = TMax.X < TMax.Y ? (TMax.X < TMax.Z ? 0 : 2) : (TMax.Y < TMax.Z ? 1 : 2);
+			const double T1 = FMath::Min(TMax[Axis], 1.0);
+
+			AddBox(A + Delta * T0, A + Delta * T1, Expansion, OutCells);
+
+			if (T1 >= 1 || Coords == EndCoords) { break; }
+
+			Coords[Axis] += Step[Axis];
+			TMax[Axis] += TDelta[Axis];
+			T0 = T1;
+		}
+
+		OutCells.Sort();
+		OutCells.SetNum(Algo::Unique(OutCells));
+	}
+
+	void FIntersectionGrid::Build(TArray<FEntry>& InEntries)
+	{
+		InEntries.Sort(
+			[](const FEntry& A, const FEntry& B)
+			{
+				if (A.Cell != B.Cell) { return A.Cell < B.Cell; }
+				return A.Item < B.Item;
+			});
+
+		Cells.Reset();
+		Offsets.Reset();
+		Items.SetNumUninitialized(InEntries.Num());
+
+		for (int i = 0; i < InEntries.Num(); i++)
+		{
+			const FEntry& Entry = InEntries[i];
+			if (Cells.IsEmpty() || Cells.Last() != Entry.Cell)
+			{
+				Cells.Add(Entry.Cell);
+				Offsets.Add(i);
+			}
+			Items[i] = Entry.Item;
+		}
+
+		Offsets.Add(InEntries.Num());
+	}
+
+	TArrayView<const int32> FIntersectionGrid::GetItems(const uint64 Cell) const
+	{
+		const int32 Index = Algo::BinarySearch(Cells, Cell);
+		if (Index == INDEX_NONE) { return TArrayView<const int32>(); }
+		return MakeArrayView(Items.GetData() + Offsets[Index], Offsets[Index + 1] - Offsets[Index]);
+	}
+
+	double ComputeGridCellSize(const TSharedPtr<FGraph>& InGraph, const TArray<FPCGPoint>& InPoints, const double InCellSize, const double InTolerance)
+	{
+		if (InCellSize > 0) { return FMath::Max(InCellSize, InTolerance * 2); }
+
+		double TotalLength = 0;
+		int32 NumValidEdges = 0;
+
+		for (const FEdge& Edge : InGraph->Edges)
+		{
+			if (!Edge.bValid) { continue; }
+			TotalLength += FVector::Dist(InPoints[Edge.Start].Transform.GetLocation(), InPoints[Edge.End].Transform.GetLocation());
+			NumValidEdges++;
+		}
+
+		return FMath::Max(NumValidEdges ? TotalLength / NumValidEdges : 100, InTolerance * 2);
+	}
+
 	FPointEdgeProxy::FPointEdgeProxy(const int32 InEdgeIndex, const FVector& InStart, const FVector& InEnd, const double Tolerance)
 	{
 		Init(InEdgeIndex, InStart, InEnd, Tolerance);
@@ -420,6 +573,25 @@ namespace PCGExGraph
 				Points[Edge.End].Transform.GetLocation(),
 				Details->FuseDetails.Tolerance);
 		}
+
+		if (Details->Broadphase != EPCGExIntersectionBroadphase::Grid) { return; }
+
+		// Each node lives in exactly one cell, so edges never see the same candidate twice
+		FBox Bounds = FBox(ForceInit);
+		for (const FPCGPoint& Point : Points) { Bounds += Point.Transform.GetLocation(); }
+
+		Grid = MakeShared<FIntersectionGrid>(Bounds, ComputeGridCellSize(InGraph, Points, Details->GridCellSize, Details->FuseDetails.Tolerance));
+
+		TArray<FIntersectionGrid::FEntry> Entries;
+		Entries.Reserve(InGraph->Nodes.Num());
+
+		for (const FNode& Node : InGraph->Nodes)
+		{
+			if (!Node.bValid) { continue; }
+			Entries.Emplace(Grid->GetCell(Points[Node.PointIndex].Transform.GetLocation()), Node.Index);
+		}
+
+		Grid->Build(Entries);
 	}
 
 	void FPointEdgeIntersections::Add(const int32 EdgeIndex, const FPESplit& Split)
@@ -500,6 +672,41 @@ namespace PCGExGraph
 		const FEdge& IEdge = Graph->Edges[EdgeIndex];
 		FPESplit Split = FPESplit{};
 
+		if (const FIntersectionGrid* Grid = InIntersections->Grid.Get())
+		{
+			// Only this edge writes to its own proxy, so splits are added without locking
+			const TSet<int32>* RootIOIndices = nullptr;
+			if (!InIntersections->Details->bEnableSelfIntersection)
+			{
+				RootIOIndices = &Graph->EdgesUnion->Entries[Graph->FindEdgeMetadata_Unsafe(Edge.EdgeIndex)->RootIndex]->IOIndices;
+			}
+
+			TArray<uint64> Cells;
+			Grid->Rasterize(Edge.Start, Edge.End, InIntersections->Details->FuseDetails.Tolerance, Cells);
+
+			for (const uint64 Cell : Cells)
+			{
+				for (const int32 NodeIndex : Grid->GetItems(Cell))
+				{
+					const FNode& Node = Graph->Nodes[NodeIndex];
+					if (!Node.bValid) { continue; }
+
+					const FVector Position = Points[Node.PointIndex].Transform.GetLocation();
+
+					if (!Edge.Box.IsInside(Position)) { continue; }
+					if (IEdge.Start == Node.PointIndex || IEdge.End == Node.PointIndex) { continue; }
+					if (!Edge.FindSplit(Position, Split)) { continue; }
+
+					if (RootIOIndices && Graph->NodesUnion->IOIndexOverlap(Node.Index, *RootIOIndices)) { continue; }
+
+					Split.NodeIndex = Node.Index;
+					InIntersections->Add_Unsafe(EdgeIndex, Split);
+				}
+			}
+
+			return;
+		}
+
 		if (!InIntersections->Details->bEnableSelfIntersection)
 		{
 			const int32 RootIndex = InIntersections->Graph->FindEdgeMetadata_Unsafe(Edge.EdgeIndex)->RootIndex;
@@ -623,6 +830,33 @@ namespace PCGExGraph
 		const int32 NumEdges = InGraph->Edges.Num();
 		Edges.SetNum(NumEdges);
 
+		if (Details->Broadphase == EPCGExIntersectionBroadphase::Grid)
+		{
+			Grid = MakeShared<FIntersectionGrid>(InUnionGraph->Bounds, ComputeGridCellSize(InGraph, Points, Details->GridCellSize, Details->Tolerance));
+
+			TArray<FIntersectionGrid::FEntry> Entries;
+			Entries.Reserve(NumEdges * 2);
+
+			TArray<uint64> Cells;
+			for (const FEdge& Edge : InGraph->Edges)
+			{
+				if (!Edge.bValid) { continue; }
+
+				FEdgeEdgeProxy& Proxy = Edges[Edge.Index];
+				Proxy.Init(
+					Edge.Index,
+					Points[Edge.Start].Transform.GetLocation(),
+					Points[Edge.End].Transform.GetLocation(),
+					Details->Tolerance);
+
+				Grid->Rasterize(Proxy.Start, Proxy.End, Details->Tolerance, Cells);
+				for (const uint64 Cell : Cells) { Entries.Emplace(Cell, Edge.Index); }
+			}
+
+			Grid->Build(Entries);
+			return;
+		}
+
 		Octree = MakeUnique<FEdgeEdgeProxyOctree>(InUnionGraph->Bounds.GetCenter(), InUnionGraph->Bounds.GetExtent().Length() + (Details->Tolerance * 2));
 
 		for (const FEdge& Edge : InGraph->Edges)
@@ -670,6 +904,20 @@ namespace PCGExGraph
 		for (const FEESplit& Split : Splits) { Add_Unsafe(Split); }
 	}
 
+	void FEdgeEdgeIntersections::PrepareScopes(const TArray<PCGExMT::FScope>& Loops)
+	{
+		ScopedSplits = MakeShared<PCGExMT::TScopedArray<FEESplit>>(Loops);
+	}
+
+	void FEdgeEdgeIntersections::CommitScopedSplits()
+	{
+		if (!ScopedSplits) { return; }
+
+		// Scopes are committed in order, so crossing indices are stable across runs
+		ScopedSplits->ForEach([&](const TArray<FEESplit>& Splits) { for (const FEESplit& Split : Splits) { Add_Unsafe(Split); } });
+		ScopedSplits.Reset();
+	}
+
 	bool FEdgeEdgeIntersections::InsertNodes() const
 	{
 		if (Crossings.IsEmpty()) { return false; }
@@ -799,4 +1047,64 @@ namespace PCGExGraph
 		// Register crossings
 		InIntersections->BatchAdd(OutSplits, EdgeIndex);
 	}
+
+	void FindOverlappingEdges(const TSharedRef<FEdgeEdgeIntersections>& InIntersections, const int32 EdgeIndex, const PCGExMT::FScope& Scope)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FindOverlappingEdges);
+
+		const FIntersectionGrid* Grid = InIntersections->Grid.Get();
+		if (!Grid)
+		{
+			FindOverlappingEdges(InIntersections, EdgeIndex);
+			return;
+		}
+
+		const FEdgeEdgeProxy& Edge = InIntersections->Edges[EdgeIndex];
+		const FPCGExEdgeEdgeIntersectionDetails* Details = InIntersections->Details;
+		TArray<FEESplit>& OutSplits = InIntersections->ScopedSplits->Get_Ref(Scope);
+
+		const TSharedPtr<PCGExData::FUnionMetadata> EdgesUnion = InIntersections->Graph->EdgesUnion;
+		const TSet<int32>* RootIOIndices = nullptr;
+		if (!Details->bEnableSelfIntersection)
+		{
+			RootIOIndices = &EdgesUnion->Entries[InIntersections->Graph->FindEdgeMetadata_Unsafe(Edge.EdgeIndex)->RootIndex]->IOIndices;
+		}
+
+		// Gather unique candidates across all the cells this edge touches
+		TArray<uint64> Cells;
+		Grid->Rasterize(Edge.Start, Edge.End, Details->Tolerance, Cells);
+
+		TArray<int32> Candidates;
+		for (const uint64 Cell : Cells)
+		{
+			for (const int32 OtherIndex : Grid->GetItems(Cell))
+			{
+				// Each pair is only tested once, from its lowest edge index
+				if (OtherIndex > EdgeIndex) { Candidates.Add(OtherIndex); }
+			}
+		}
+
+		Candidates.Sort();
+		Candidates.SetNum(Algo::Unique(Candidates));
+
+		for (const int32 OtherIndex : Candidates)
+		{
+			const FEdgeEdgeProxy& OtherEdge = InIntersections->Edges[OtherIndex];
+
+			if (OtherEdge.EdgeIndex == -1) { continue; }
+			if (!Edge.Box.Intersect(OtherEdge.Box)) { continue; }
+
+			if (RootIOIndices)
+			{
+				if (Details->bUseMinAngle || Details->bUseMaxAngle)
+				{
+					if (!Details->CheckDot(FMath::Abs(FVector::DotProduct(Edge.Direction, OtherEdge.Direction)))) { continue; }
+				}
+
+				if (EdgesUnion->IOIndexOverlap(InIntersections->Graph->FindEdgeMetadata_Unsafe(OtherEdge.EdgeIndex)->RootIndex, *RootIOIndices)) { continue; }
+			}
+
+			Edge.FindSplit(OtherEdge, OutSplits);
+		}
+	}
 }
@@ -57,6 +57,7 @@ bool FPCGExMeshToClustersElement::Boot(FPCGExContext* InContext) const
 
 	Context->StaticMeshMap = MakeShared<PCGExGeo::FGeoStaticMeshMap>();
 	Context->StaticMeshMap->DesiredTriangulationType = Settings->GraphOutputType;
+	Context->StaticMeshMap->LODIndex = Settings->LODIndex;
 
 	Context->RootVtx = MakeShared<PCGExData::FPointIOCollection>(Context); // Make this pinless
 
@@ -221,28 +222,18 @@ namespace PCGExMeshToCluster
 		FPCGExMeshToClustersContext* Context = AsyncManager->GetContext<FPCGExMeshToClustersContext>();
 		PCGEX_SETTINGS(MeshToClusters)
 
-		switch (Mesh->DesiredTriangulationType)
-		{
-		default: ;
-		case EPCGExTriangulationType::Raw:
-			Mesh->ExtractMeshSynchronous();
-			break;
-		case EPCGExTriangulationType::Dual:
-			Mesh->TriangulateMeshSynchronous();
-			Mesh->MakeDual();
-			break;
-		case EPCGExTriangulationType::Hollow:
-			Mesh->TriangulateMeshSynchronous();
-			Mesh->MakeHollowDual();
-			break;
-		}
+		// Topology is cached per mesh, LOD & triangulation type; instances only get their transform applied when copied to points
+		Mesh->ExtractTopologySynchronous();
+		if (!Mesh->Topology) { return; }
+
+		const PCGExGeo::FMeshTopology& Topology = *Mesh->Topology;
 
 		const TSharedPtr<PCGExData::FPointIO> RootVtx = Context->RootVtx->Emplace_GetRef<UPCGExClusterNodesData>();
 		if (!RootVtx) { return; }
 
 		RootVtx->IOIndex = TaskIndex;
 		TArray<FPCGPoint>& VtxPoints = RootVtx->GetOut()->GetMutablePoints();
-		VtxPoints.SetNum(Mesh->Vertices.Num());
+		VtxPoints.SetNum(Topology.Vertices.Num());
 
 		PCGEX_MAKE_SHARED(RootVtxFacade, PCGExData::FFacade, RootVtx.ToSharedRef())
 
@@ -252,10 +243,10 @@ namespace PCGExMeshToCluster
 		for (int i = 0; i < VtxPoints.Num(); i++)
 		{
 			FPCGPoint& NewVtx = VtxPoints[i];
-			NewVtx.Transform.SetLocation(Mesh->Vertices[i]);
+			NewVtx.Transform.SetLocation(Topology.Vertices[i]);
 		}
 
-		GraphBuilder->Graph->InsertEdges(Mesh->Edges, -1);
+		GraphBuilder->Graph->InsertEdges(Topology.Edges, -1);
 		GraphBuilder->CompileAsync(Context->GetAsyncManager(), true);
 	}
 }
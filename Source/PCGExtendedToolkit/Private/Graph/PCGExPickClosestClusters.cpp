@@ -18,59 +18,61 @@ TArray<FPCGPinProperties> UPCGExPickClosestClustersSettings::InputPinProperties(
 	return PinProperties;
 }
 
-void FPCGExPickClosestClustersContext::ClusterProcessing_InitialProcessingDone()
+bool FPCGExPickClosestClustersContext::StartSearch()
 {
-	FPCGExEdgesProcessorContext::ClusterProcessing_InitialProcessingDone();
-
-	TArray<TSharedPtr<PCGExPickClosestClusters::FProcessor>> Processors;
 	GatherClusterProcessors(Processors);
+	Processors.RemoveAll([](const TSharedPtr<PCGExPickClosestClusters::FProcessor>& Processor) { return !Processor->bIsProcessorValid || !Processor->Cluster; });
 
 	const int32 NumTargets = TargetDataFacade->Source->GetNum();
+	Picks.Init(-1, NumTargets);
 
-	PCGEX_SETTINGS_LOCAL(PickClosestClusters)
+	if (Processors.IsEmpty() || !NumTargets) { return false; }
 
-	if (Settings->PickMode == EPCGExClusterClosestPickMode::OnlyBest)
-	{
-		for (int i = 0; i < NumTargets; i++)
-		{
-			int32 Pick = -1;
-			double Closest = MAX_dbl;
+	TArray<FBox> ClusterBounds;
+	PCGEx::InitArray(ClusterBounds, Processors.Num());
+	for (int i = 0; i < Processors.Num(); i++) { ClusterBounds[i] = Processors[i]->Cluster->Bounds; }
 
-			for (int j = 0; j < Processors.Num(); j++)
-			{
-				const double Dist = Processors[j]->Distances[i];
-				if (Closest > Dist)
-				{
-					Closest = Dist;
-					Pick = j;
-				}
-			}
+	ClusterBVH = MakeShared<PCGExGeo::FBoxBVH>();
+	ClusterBVH->Build(ClusterBounds);
 
-			if (Pick == -1) { continue; }
-			Processors[Pick]->Picker = i;
-		}
-	}
-	else
-	{
-		for (int i = 0; i < NumTargets; i++)
+	return true;
+}
+
+int32 FPCGExPickClosestClustersContext::FindBestPick(const int32 TargetIndex, const TBitArray<>* Excluded) const
+{
+	const FPCGPoint& Point = TargetDataFacade->Source->GetInPoint(TargetIndex);
+	const FVector TargetLocation = Point.Transform.GetLocation();
+	const FVector SearchExtents = Point.GetScaledExtents() + FVector(TargetBoundsExpansion);
+
+	// Without expansion, only clusters overlapping the target bounds can yield a distance
+	const double MaxDistSquared = bExpandSearchOutsideTargetBounds ? MAX_dbl : SearchExtents.SizeSquared();
+
+	int32 Pick = -1;
+	double Closest = MAX_dbl;
+
+	ClusterBVH->FindClosest(
+		TargetLocation, [&](const int32 Index, const double BoxDistSquared)
 		{
-			int32 Pick = -1;
-			double Closest = MAX_dbl;
+			if (Excluded && (*Excluded)[Index]) { return Closest; }
+
+			const double Dist = Processors[Index]->GetDistance(TargetIndex);
 
-			for (int j = 0; j < Processors.Num(); j++)
+			// Lowest processor index wins ties, as when iterating processors in order
+			if (Dist < Closest || (Dist == Closest && Pick != -1 && Index < Pick))
 			{
-				const double Dist = Processors[j]->Distances[i];
-				if (Closest > Dist && Processors[j]->Picker == 0)
-				{
-					Closest = Dist;
-					Pick = j;
-				}
+				Closest = Dist;
+				Pick = Index;
 			}
 
-			if (Pick == -1) { continue; }
-			Processors[Pick]->Picker = i;
-		}
-	}
+			return Closest;
+		}, MaxDistSquared);
+
+	return Pick;
+}
+
+void FPCGExPickClosestClustersContext::ApplyPicks()
+{
+	for (int i = 0; i < Picks.Num(); i++) { if (Picks[i] != -1) { Processors[Picks[i]]->Picker = i; } }
 }
 
 PCGEX_INITIALIZE_ELEMENT(PickClosestClusters)
@@ -85,6 +87,8 @@ bool FPCGExPickClosestClustersElement::Boot(FPCGExContext* InContext) const
 	if (!Context->TargetDataFacade) { return false; }
 
 	PCGEX_FWD(TargetAttributesToTags)
+	PCGEX_FWD(TargetBoundsExpansion)
+	PCGEX_FWD(bExpandSearchOutsideTargetBounds)
 
 	if (!Context->TargetAttributesToTags.Init(Context, Context->TargetDataFacade)) { return false; }
 
@@ -109,16 +113,79 @@ bool FPCGExPickClosestClustersElement::ExecuteInternal(
 			[](const TSharedPtr<PCGExData::FPointIOTaggedEntries>& Entries) { return true; },
 			[&](const TSharedPtr<PCGExPickClosestClusters::FBatch>& NewBatch)
 			{
+				// Completion needs picks, which need every cluster to be ready
+				NewBatch->bSkipCompletion = true;
 			}))
 		{
 			return Context->CancelExecution(TEXT("Could not build any clusters."));
 		}
 	}
 
-	PCGEX_CLUSTER_BATCH_PROCESSING(PCGEx::State_Done)
+	PCGEX_CLUSTER_BATCH_PROCESSING(PCGExPickClosestClusters::State_SearchingTargets)
+
+	PCGEX_ON_STATE(PCGExPickClosestClusters::State_SearchingTargets)
+	{
+		if (!Context->StartSearch())
+		{
+			Context->SetState(PCGExPickClosestClusters::State_Picking);
+		}
+		else
+		{
+			Context->SetAsyncState(PCGExPickClosestClusters::State_Picking);
+			PCGEX_ASYNC_GROUP_CHKD(Context->GetAsyncManager(), SearchTargetsTask)
+
+			if (Settings->PickMode == EPCGExClusterClosestPickMode::OnlyBest)
+			{
+				SearchTargetsTask->OnIterationCallback =
+					[Context](const int32 Index, const PCGExMT::FScope& Scope)
+					{
+						Context->Picks[Index] = Context->FindBestPick(Index);
+					};
+
+				SearchTargetsTask->StartIterations(Context->Picks.Num(), 64);
+			}
+			else
+			{
+				// Each pick depends on the previous ones
+				SearchTargetsTask->AddSimpleCallback(
+					[Context]()
+					{
+						TBitArray<> Picked;
+						Picked.Init(false, Context->Processors.Num());
+
+						for (int i = 0; i < Context->Picks.Num(); i++)
+						{
+							const int32 Pick = Context->FindBestPick(i, &Picked);
+							if (Pick == -1) { continue; }
+
+							Context->Picks[i] = Pick;
+							Picked[Pick] = true;
+						}
+					});
+
+				SearchTargetsTask->StartSimpleCallbacks();
+			}
+
+			return false;
+		}
+	}
+
+	PCGEX_ON_ASYNC_STATE_READY(PCGExPickClosestClusters::State_Picking)
+	{
+		Context->ApplyPicks();
 
-	Context->OutputBatches();
-	Context->OutputPointsAndEdges();
+		Context->SetAsyncState(PCGExPickClosestClusters::State_CompletingPicks);
+		for (const TSharedPtr<PCGExClusterMT::FClusterProcessorBatchBase>& Batch : Context->Batches) { Batch->bSkipCompletion = false; }
+		PCGExClusterMT::CompleteBatches(Context->Batches);
+		return false;
+	}
+
+	PCGEX_ON_ASYNC_STATE_READY(PCGExPickClosestClusters::State_CompletingPicks)
+	{
+		Context->OutputBatches();
+		Context->OutputPointsAndEdges();
+		Context->Done();
+	}
 
 	return Context->TryComplete();
 }
@@ -134,86 +201,74 @@ namespace PCGExPickClosestClusters
 	{
 		if (!FClusterProcessor::Process(InAsyncManager)) { return false; }
 
+		// Octree is built lazily, only if this cluster survives the bounds pruning for at least one target
+		return true;
+	}
 
-		Cluster->RebuildOctree(Settings->SearchMode);
-		Search();
+	void FProcessor::EnsureOctree()
+	{
+		{
+			FReadScopeLock ReadScopeLock(OctreeLock);
+			if (bOctreeReady) { return; }
+		}
 
-		return true;
+		FWriteScopeLock WriteScopeLock(OctreeLock);
+		if (bOctreeReady) { return; }
+
+		Cluster->RebuildOctree(Settings->SearchMode);
+		bOctreeReady = true;
 	}
 
-	void FProcessor::Search()
+	double FProcessor::GetDistance(const int32 TargetIndex)
 	{
-		const int32 NumTargets = Context->TargetDataFacade->Source->GetNum();
-		PCGEx::InitArray(Distances, NumTargets);
+		EnsureOctree();
+
+		double Distance = MAX_dbl;
 
-		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, ProcessTargets)
+		const FPCGPoint& Point = Context->TargetDataFacade->Source->GetInPoint(TargetIndex);
+		const FVector TargetLocation = Point.Transform.GetLocation();
+		const FBoxCenterAndExtent SearchBounds = FBoxCenterAndExtent(TargetLocation, Point.GetScaledExtents() + FVector(Settings->TargetBoundsExpansion));
+
+		bool bFound = false;
 
 		if (Settings->SearchMode == EPCGExClusterClosestSearchMode::Edge)
 		{
-			ProcessTargets->OnIterationCallback =
-				[PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
+			Cluster->GetEdgeOctree()->FindElementsWithBoundsTest(
+				SearchBounds, [&](const PCGEx::FIndexedItem& Item)
 				{
-					PCGEX_ASYNC_THIS
-
-					This->Distances[Index] = MAX_dbl;
-
-					const FPCGPoint& Point = This->Context->TargetDataFacade->Source->GetInPoint(Index);
-					const FVector TargetLocation = Point.Transform.GetLocation();
-
-					bool bFound = false;
-					This->Cluster->GetEdgeOctree()->FindElementsWithBoundsTest(
-						FBoxCenterAndExtent(TargetLocation, Point.GetScaledExtents() + FVector(This->Settings->TargetBoundsExpansion)),
-						[&](const PCGEx::FIndexedItem& Item)
-						{
-							This->Distances[Index] = FMath::Min(This->Distances[Index], FVector::DistSquared(TargetLocation, This->Cluster->GetClosestPointOnEdge(Item.Index, TargetLocation)));
-							bFound = true;
-						});
+					Distance = FMath::Min(Distance, FVector::DistSquared(TargetLocation, Cluster->GetClosestPointOnEdge(Item.Index, TargetLocation)));
+					bFound = true;
+				});
 
-					if (!bFound && This->Settings->bExpandSearchOutsideTargetBounds)
+			if (!bFound && Settings->bExpandSearchOutsideTargetBounds)
+			{
+				Cluster->GetEdgeOctree()->FindNearbyElements(
+					TargetLocation, [&](const PCGEx::FIndexedItem& Item)
 					{
-						This->Cluster->GetEdgeOctree()->FindNearbyElements(
-							TargetLocation, [&](const PCGEx::FIndexedItem& Item)
-							{
-								This->Distances[Index] = FMath::Min(This->Distances[Index], FVector::DistSquared(TargetLocation, This->Cluster->GetPos(Item.Index)));
-								bFound = true;
-							});
-					}
-				};
+						Distance = FMath::Min(Distance, FVector::DistSquared(TargetLocation, Cluster->GetPos(Item.Index)));
+					});
+			}
 		}
 		else
 		{
-			ProcessTargets->OnIterationCallback =
-				[PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
+			Cluster->NodeOctree->FindElementsWithBoundsTest(
+				SearchBounds, [&](const PCGEx::FIndexedItem& Item)
 				{
-					PCGEX_ASYNC_THIS
-
-					This->Distances[Index] = MAX_dbl;
-
-					const FPCGPoint& Point = This->Context->TargetDataFacade->Source->GetInPoint(Index);
-					const FVector TargetLocation = Point.Transform.GetLocation();
+					Distance = FMath::Min(Distance, FVector::DistSquared(TargetLocation, Cluster->GetPos(Item.Index)));
+					bFound = true;
+				});
 
-					bool bFound = false;
-					This->Cluster->NodeOctree->FindElementsWithBoundsTest(
-						FBoxCenterAndExtent(TargetLocation, Point.GetScaledExtents() + FVector(This->Settings->TargetBoundsExpansion)),
-						[&](const PCGEx::FIndexedItem& Item)
-						{
-							This->Distances[Index] = FMath::Min(This->Distances[Index], FVector::DistSquared(TargetLocation, This->Cluster->GetPos(Item.Index)));
-							bFound = true;
-						});
-
-					if (!bFound && This->Settings->bExpandSearchOutsideTargetBounds)
+			if (!bFound && Settings->bExpandSearchOutsideTargetBounds)
+			{
+				Cluster->NodeOctree->FindNearbyElements(
+					TargetLocation, [&](const PCGEx::FIndexedItem& Item)
 					{
-						This->Cluster->NodeOctree->FindNearbyElements(
-							TargetLocation, [&](const PCGEx::FIndexedItem& Item)
-							{
-								This->Distances[Index] = FMath::Min(This->Distances[Index], FVector::DistSquared(TargetLocation, This->Cluster->GetPos(Item.Index)));
-								bFound = true;
-							});
-					}
-				};
+						Distance = FMath::Min(Distance, FVector::DistSquared(TargetLocation, Cluster->GetPos(Item.Index)));
+					});
+			}
 		}
 
-		ProcessTargets->StartIterations(NumTargets, 256);
+		return Distance;
 	}
 
 	void FProcessor::CompleteWork()
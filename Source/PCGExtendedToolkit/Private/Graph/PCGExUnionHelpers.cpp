@@ -344,23 +344,51 @@ namespace PCGExGraph
 			[PCGEX_ASYNC_THIS_CAPTURE]()
 			{
 				PCGEX_ASYNC_THIS
+				if (This->EdgeEdgeIntersections) { This->EdgeEdgeIntersections->CommitScopedSplits(); }
 				This->OnEdgeEdgeIntersectionsFound();
 			};
 
-		FindEdgeEdgeGroup->OnSubLoopStartCallback =
-			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
-			{
-				PCGEX_ASYNC_THIS
-				if (!This->EdgeEdgeIntersections) { return; }
-				const TSharedRef<FEdgeEdgeIntersections> EEI = This->EdgeEdgeIntersections.ToSharedRef();
+		if (EdgeEdgeIntersections->Grid)
+		{
+			// Grid broadphase writes splits into per-scope arrays that are committed once all scopes are done
+			FindEdgeEdgeGroup->OnPrepareSubLoopsCallback =
+				[PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops)
+				{
+					PCGEX_ASYNC_THIS
+					This->EdgeEdgeIntersections->PrepareScopes(Loops);
+				};
 
-				for (int i = Scope.Start; i < Scope.End; i++)
+			FindEdgeEdgeGroup->OnSubLoopStartCallback =
+				[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
 				{
-					const FEdge& Edge = This->GraphBuilder->Graph->Edges[i];
-					if (!Edge.bValid) { continue; }
-					FindOverlappingEdges(EEI, i);
-				}
-			};
+					PCGEX_ASYNC_THIS
+					const TSharedRef<FEdgeEdgeIntersections> EEI = This->EdgeEdgeIntersections.ToSharedRef();
+
+					for (int i = Scope.Start; i < Scope.End; i++)
+					{
+						const FEdge& Edge = This->GraphBuilder->Graph->Edges[i];
+						if (!Edge.bValid) { continue; }
+						FindOverlappingEdges(EEI, i, Scope);
+					}
+				};
+		}
+		else
+		{
+			FindEdgeEdgeGroup->OnSubLoopStartCallback =
+				[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+				{
+					PCGEX_ASYNC_THIS
+					if (!This->EdgeEdgeIntersections) { return; }
+					const TSharedRef<FEdgeEdgeIntersections> EEI = This->EdgeEdgeIntersections.ToSharedRef();
+
+					for (int i = Scope.Start; i < Scope.End; i++)
+					{
+						const FEdge& Edge = This->GraphBuilder->Graph->Edges[i];
+						if (!Edge.bValid) { continue; }
+						FindOverlappingEdges(EEI, i);
+					}
+				};
+		}
 
 
 		FindEdgeEdgeGroup->StartSubLoops(GraphBuilder->Graph->Edges.Num(), GetDefault<UPCGExGlobalSettings>()->ClusterDefaultBatchChunkSize);
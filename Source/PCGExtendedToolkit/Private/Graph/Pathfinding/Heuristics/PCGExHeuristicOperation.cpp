@@ -4,12 +4,18 @@
 
 #include "Graph/Pathfinding/Heuristics/PCGExHeuristicOperation.h"
 
+namespace PCGExHeuristics
+{
+	constexpr int32 ScoreLUTSize = 1024;
+}
 
 void UPCGExHeuristicOperation::PrepareForCluster(const TSharedPtr<const PCGExCluster::FCluster>& InCluster)
 {
 	Cluster = InCluster;
 	LocalWeightMultiplier.Empty();
 
+	if (ScoreLUT.IsEmpty()) { BuildScoreLUT(); }
+
 	bHasCustomLocalWeightMultiplier = false;
 	if (bUseLocalWeightMultiplier)
 	{
@@ -61,10 +67,28 @@ void UPCGExHeuristicOperation::Cleanup()
 {
 	Cluster = nullptr;
 	LocalWeightMultiplier.Empty();
+	ScoreLUT.Empty();
 	Super::Cleanup();
 }
 
+void UPCGExHeuristicOperation::BuildScoreLUT()
+{
+	if (!ScoreCurve) { return; }
+
+	// Sampled in "final" time so inversion & clamping are folded in
+	ScoreLUT.SetNumUninitialized(PCGExHeuristics::ScoreLUTSize + 1);
+	for (int i = 0; i <= PCGExHeuristics::ScoreLUTSize; i++)
+	{
+		const double Time = static_cast<double>(i) / PCGExHeuristics::ScoreLUTSize;
+		ScoreLUT[i] = FMath::Max(0, ScoreCurve->Eval(bInvert ? 1 - Time : Time)) * ReferenceWeight;
+	}
+}
+
 double UPCGExHeuristicOperation::GetScoreInternal(const double InTime) const
 {
-	return FMath::Max(0, ScoreCurve->Eval(bInvert ? 1 - InTime : InTime)) * ReferenceWeight;
+	if (ScoreLUT.IsEmpty() || InTime < 0 || InTime > 1) { return FMath::Max(0, ScoreCurve->Eval(bInvert ? 1 - InTime : InTime)) * ReferenceWeight; }
+
+	const double Sample = InTime * PCGExHeuristics::ScoreLUTSize;
+	const int32 Index = FMath::Min(static_cast<int32>(Sample), PCGExHeuristics::ScoreLUTSize - 1);
+	return FMath::Lerp(ScoreLUT[Index], ScoreLUT[Index + 1], Sample - Index);
 }
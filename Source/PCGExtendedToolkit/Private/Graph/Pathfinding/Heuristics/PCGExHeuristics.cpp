@@ -3,7 +3,6 @@
 
 #include "Graph/Pathfinding/Heuristics/PCGExHeuristics.h"
 
-
 #include "Graph/Pathfinding/Heuristics/PCGExHeuristicDistance.h"
 #include "Graph/Pathfinding/Heuristics/PCGExHeuristicFeedback.h"
 #include "Graph/Pathfinding/Heuristics/PCGExHeuristicOperation.h"
@@ -79,6 +78,7 @@ namespace PCGExHeuristics
 		InCluster->ComputeEdgeLengths(true); // TODO : Make our own copy
 
 		Cluster = InCluster;
+		MinScorePerLength = -1;
 		bUseDynamicWeight = false;
 		for (UPCGExHeuristicOperation* Operation : Operations)
 		{
@@ -91,6 +91,105 @@ namespace PCGExHeuristics
 	{
 		TotalStaticWeight = 0;
 		for (const UPCGExHeuristicOperation* Op : Operations) { TotalStaticWeight += Op->WeightFactor; }
+
+		StaticOperations.Reset();
+		DynamicOperations.Reset();
+
+		for (const UPCGExHeuristicOperation* Op : Operations)
+		{
+			if (Op->IsEdgeScoreStatic()) { StaticOperations.Add(Op); }
+			else { DynamicOperations.Add(Op); }
+		}
+
+		// Static scores & weights for both directions of every edge, filled by BakeEdgeScores
+		const int32 NumEdges = Cluster->Edges->Num();
+		StaticEdgeScores.SetNumZeroed(NumEdges * 2);
+		if (bUseDynamicWeight) { EdgeWeights.SetNumUninitialized(NumEdges * 2); }
+		else { EdgeWeights.Empty(); }
+	}
+
+	void FHeuristicsHandler::BakeEdgeScores(const PCGExMT::FScope& Scope)
+	{
+		for (int i = Scope.Start; i < Scope.End; i++)
+		{
+			const PCGExGraph::FEdge& Edge = *Cluster->GetEdge(i);
+			const PCGExCluster::FNode& StartNode = *Cluster->GetEdgeStart(Edge);
+			const PCGExCluster::FNode& EndNode = *Cluster->GetEdgeEnd(Edge);
+
+			const int32 Forward = GetEdgeSlot(StartNode, Edge);
+			const int32 Backward = GetEdgeSlot(EndNode, Edge);
+
+			// Static operations ignore seed & goal, endpoints are only used as placeholders
+			for (const UPCGExHeuristicOperation* Op : StaticOperations)
+			{
+				StaticEdgeScores[Forward] += Op->GetEdgeScore(StartNode, EndNode, Edge, StartNode, EndNode);
+				StaticEdgeScores[Backward] += Op->GetEdgeScore(EndNode, StartNode, Edge, EndNode, StartNode);
+			}
+
+			if (!bUseDynamicWeight) { continue; }
+
+			double ForwardWeight = 0;
+			double BackwardWeight = 0;
+			for (const UPCGExHeuristicOperation* Op : Operations)
+			{
+				ForwardWeight += Op->WeightFactor * Op->GetCustomWeightMultiplier(EndNode.Index, Edge.PointIndex);
+				BackwardWeight += Op->WeightFactor * Op->GetCustomWeightMultiplier(StartNode.Index, Edge.PointIndex);
+			}
+
+			EdgeWeights[Forward] = ForwardWeight;
+			EdgeWeights[Backward] = BackwardWeight;
+		}
+	}
+
+	bool FHeuristicsHandler::IsQueryIndependent() const
+	{
+		for (const UPCGExHeuristicOperation* Op : Operations) { if (!Op->IsQueryIndependent()) { return false; } }
+		return true;
+	}
+
+	double FHeuristicsHandler::GetMinScorePerLength() const
+	{
+		{
+			FReadScopeLock ReadScopeLock(HandlerLock);
+			if (MinScorePerLength >= 0) { return MinScorePerLength; }
+		}
+
+		FWriteScopeLock WriteScopeLock(HandlerLock);
+		if (MinScorePerLength >= 0) { return MinScorePerLength; }
+
+		if (!IsQueryIndependent())
+		{
+			MinScorePerLength = 0;
+			return MinScorePerLength;
+		}
+
+		// Feedback only ever adds to scores, so sampling them now keeps this a valid lower bound.
+		// Local feedback weights do however dilute static scores when they're part of the normalization.
+		const TArray<PCGExCluster::FNode>& NodesRef = *Cluster->Nodes;
+		double MinRatio = MAX_dbl;
+
+		double Dilution = 1;
+		if (!bUseDynamicWeight && !LocalFeedbackFactories.IsEmpty())
+		{
+			double LocalWeight = 0;
+			for (const UPCGExHeuristicsFactoryData* Factory : LocalFeedbackFactories) { LocalWeight += Factory->WeightFactor; }
+			Dilution = TotalStaticWeight / (TotalStaticWeight + LocalWeight);
+		}
+
+		for (const PCGExGraph::FEdge& Edge : *Cluster->Edges)
+		{
+			const PCGExCluster::FNode& A = NodesRef[Cluster->NodeIndexLookup->Get(Edge.Start)];
+			const PCGExCluster::FNode& B = NodesRef[Cluster->NodeIndexLookup->Get(Edge.End)];
+
+			const double Length = Cluster->GetDist(A, B);
+			if (Length <= 0) { continue; }
+
+			const double Score = FMath::Min(GetEdgeScore(A, B, Edge, A, B), GetEdgeScore(B, A, Edge, B, A));
+			MinRatio = FMath::Min(MinRatio, Score / Length);
+		}
+
+		MinScorePerLength = MinRatio == MAX_dbl ? 0 : FMath::Max(0.0, MinRatio * Dilution);
+		return MinScorePerLength;
 	}
 
 	TSharedPtr<FLocalFeedbackHandler> FHeuristicsHandler::MakeLocalFeedbackHandler(const TSharedPtr<const PCGExCluster::FCluster>& InCluster)
@@ -38,6 +38,8 @@ namespace PCGExGrowPaths
 		SoftMaxIterations = InMaxIterations;
 		Path.Reserve(MaxIterations);
 		Path.Add(InLastGrowthIndex);
+		Visited.Init(false, Processor->Cluster->Nodes->Num());
+		Visited[InLastGrowthIndex] = true;
 		Init();
 	}
 
@@ -70,7 +72,7 @@ namespace PCGExGrowPaths
 				if (bNoGrowth) { continue; }
 			}
 
-			if (Path.Contains(Lk.Node)) { continue; }
+			if (Visited[Lk.Node]) { continue; }
 
 			/*
 			// TODO : Implement
@@ -94,7 +96,7 @@ namespace PCGExGrowPaths
 
 	bool FGrowth::Grow()
 	{
-		if (NextGrowthIndex <= -1 || Path.Contains(NextGrowthIndex)) { return false; }
+		if (NextGrowthIndex <= -1 || Visited[NextGrowthIndex]) { return false; }
 
 		TravelStack->Set(NextGrowthIndex, PCGEx::NH64(LastGrowthIndex, NextGrowthEdgeIndex));
 
@@ -111,6 +113,7 @@ namespace PCGExGrowPaths
 
 		Iteration++;
 		Path.Add(NextGrowthIndex);
+		Visited[NextGrowthIndex] = true;
 		LastGrowthIndex = NextGrowthIndex;
 
 		if (Processor->GetSettings()->NumIterations == EPCGExGrowthValueSource::VtxAttribute)
@@ -405,8 +408,7 @@ namespace PCGExGrowPaths
 			}
 		}
 
-		if (IsTrivial()) { Grow(); }
-		else { PCGEX_LAUNCH(FGrowTask, ThisPtr) }
+		StartGrowth();
 
 		return true;
 	}
@@ -416,9 +418,95 @@ namespace PCGExGrowPaths
 		for (const TSharedPtr<FGrowth>& Growth : Growths) { Growth->Write(); }
 	}
 
+	void FProcessor::StartGrowth()
+	{
+		if (QueuedGrowths.IsEmpty()) { return; }
+
+		if (IsTrivial())
+		{
+			Grow();
+			return;
+		}
+
+		if (!HeuristicsHandler->HasGlobalFeedback())
+		{
+			// Growths can't influence each other, grow them all to completion in parallel.
+			PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, GrowTask)
+
+			GrowTask->OnCompleteCallback =
+				[PCGEX_ASYNC_THIS_CAPTURE]()
+				{
+					PCGEX_ASYNC_THIS
+					This->QueuedGrowths.Empty();
+				};
+
+			GrowTask->OnSubLoopStartCallback =
+				[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+				{
+					PCGEX_ASYNC_THIS
+					for (int i = Scope.Start; i < Scope.End; i++)
+					{
+						const TSharedPtr<FGrowth>& Growth = This->QueuedGrowths[i];
+						while (Growth->FindNextGrowthNodeIndex() != -1 && Growth->Grow())
+						{
+						}
+					}
+				};
+
+			GrowTask->StartSubLoops(QueuedGrowths.Num(), 8);
+			return;
+		}
+
+		if (Settings->GrowthMode == EPCGExGrowthIterationMode::Sequence)
+		{
+			// Each growth feeds back into the next one, this is inherently serial
+			PCGEX_SHARED_THIS_DECL
+			PCGEX_LAUNCH(FGrowTask, ThisPtr)
+			return;
+		}
+
+		StepGrowths();
+	}
+
+	void FProcessor::StepGrowths()
+	{
+		// One lock-step iteration : every active growth picks its next node in parallel (read-only),
+		// then steps are committed in growth order so feedback on shared nodes resolves deterministically.
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, StepTask)
+
+		StepTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->CommitGrowthStep();
+				if (!This->QueuedGrowths.IsEmpty()) { This->StepGrowths(); }
+			};
+
+		StepTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				for (int i = Scope.Start; i < Scope.End; i++) { This->QueuedGrowths[i]->FindNextGrowthNodeIndex(); }
+			};
+
+		StepTask->StartSubLoops(QueuedGrowths.Num(), 64);
+	}
+
+	void FProcessor::CommitGrowthStep()
+	{
+		int32 WriteIndex = 0;
+		for (int i = 0; i < QueuedGrowths.Num(); i++)
+		{
+			const TSharedPtr<FGrowth> Growth = QueuedGrowths[i];
+			if (Growth->Grow()) { QueuedGrowths[WriteIndex++] = Growth; }
+		}
+
+		QueuedGrowths.SetNum(WriteIndex);
+	}
+
 	void FProcessor::Grow()
 	{
-		if (Settings->GrowthMode == EPCGExGrowthIterationMode::Parallel)
+		if (Settings->GrowthMode == EPCGExGrowthIterationMode::Sequence)
 		{
 			for (const TSharedPtr<FGrowth>& Growth : QueuedGrowths)
 			{
@@ -433,18 +521,8 @@ namespace PCGExGrowPaths
 		{
 			while (!QueuedGrowths.IsEmpty())
 			{
-				for (int i = 0; i < QueuedGrowths.Num(); i++)
-				{
-					const TSharedPtr<FGrowth>& Growth = QueuedGrowths[i];
-
-					Growth->FindNextGrowthNodeIndex();
-
-					if (!Growth->Grow())
-					{
-						QueuedGrowths.RemoveAt(i);
-						i--;
-					}
-				}
+				for (const TSharedPtr<FGrowth>& Growth : QueuedGrowths) { Growth->FindNextGrowthNodeIndex(); }
+				CommitGrowthStep();
 			}
 		}
 	}
@@ -0,0 +1,213 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+
+#include "Graph/Pathfinding/Search/PCGExSearchBidirectional.h"
+
+#include "Graph/PCGExCluster.h"
+#include "Graph/Pathfinding/Heuristics/PCGExHeuristics.h"
+#include "Graph/Pathfinding/Search/PCGExScoredQueue.h"
+
+void UPCGExSearchBidirectional::CopySettingsFrom(const UPCGExOperation* Other)
+{
+	Super::CopySettingsFrom(Other);
+	if (const UPCGExSearchBidirectional* TypedOther = Cast<UPCGExSearchBidirectional>(Other))
+	{
+		bUseGlobalScores = TypedOther->bUseGlobalScores;
+	}
+}
+
+bool UPCGExSearchBidirectional::ResolveQuery(
+	const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
+	const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& Heuristics,
+	const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback) const
+{
+	check(InQuery->PickResolution == PCGExPathfinding::EQueryPickResolution::Success)
+
+	const TArray<PCGExCluster::FNode>& NodesRef = *Cluster->Nodes;
+	const TArray<PCGExGraph::FEdge>& EdgesRef = *Cluster->Edges;
+
+	const PCGExCluster::FNode& SeedNode = *InQuery->Seed.Node;
+	const PCGExCluster::FNode& GoalNode = *InQuery->Goal.Node;
+
+	if (SeedNode.Index == GoalNode.Index) { return false; }
+
+	const int32 NumNodes = NodesRef.Num();
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchBidirectional::FindPath);
+
+	const PCGExHeuristics::FLocalFeedbackHandler* Feedback = LocalFeedback.Get();
+
+	// Average potential, P(v) = (toward goal - toward seed) / 2.
+	// Reduced edge costs are then identical for both fronts, which keeps the meet-in-the-middle criterion exact
+	// as long as heuristics are consistent. Without global scores, P = 0 and this is a bidirectional Dijkstra.
+	TArray<double> Potentials;
+	TBitArray<> HasPotential;
+	if (bUseGlobalScores)
+	{
+		Potentials.SetNumUninitialized(NumNodes);
+		HasPotential.Init(false, NumNodes);
+	}
+
+	auto GetPotential = [&](const PCGExCluster::FNode& Node)
+	{
+		if (!bUseGlobalScores) { return 0.0; }
+		if (HasPotential[Node.Index]) { return Potentials[Node.Index]; }
+
+		const double TowardGoal = Heuristics->GetGlobalScore(Node, SeedNode, GoalNode, Feedback);
+		const double TowardSeed = Heuristics->GetGlobalScore(Node, GoalNode, SeedNode, Feedback);
+		const double P = (TowardGoal - TowardSeed) * 0.5 * Heuristics->ReferenceWeight;
+
+		HasPotential[Node.Index] = true;
+		Potentials[Node.Index] = P;
+		return P;
+	};
+
+	TBitArray<> VisitedForward;
+	TBitArray<> VisitedBackward;
+	VisitedForward.Init(false, NumNodes);
+	VisitedBackward.Init(false, NumNodes);
+
+	// Forward stack stores the predecessor toward the seed, backward stack the successor toward the goal
+	const TSharedPtr<PCGEx::FHashLookup> ForwardStack = PCGEx::NewHashLookup<PCGEx::FArrayHashLookup>(PCGEx::NH64(-1, -1), NumNodes);
+	const TSharedPtr<PCGEx::FHashLookup> BackwardStack = PCGEx::NewHashLookup<PCGEx::FArrayHashLookup>(PCGEx::NH64(-1, -1), NumNodes);
+
+	TArray<double> GForward;
+	TArray<double> GBackward;
+	GForward.Init(-1, NumNodes);
+	GBackward.Init(-1, NumNodes);
+
+	GForward[SeedNode.Index] = 0;
+	GBackward[GoalNode.Index] = 0;
+
+	const TUniquePtr<PCGExSearch::FScoredQueue> ForwardQueue = MakeUnique<PCGExSearch::FScoredQueue>(NumNodes, SeedNode.Index, GetPotential(SeedNode));
+	const TUniquePtr<PCGExSearch::FScoredQueue> BackwardQueue = MakeUnique<PCGExSearch::FScoredQueue>(NumNodes, GoalNode.Index, -GetPotential(GoalNode));
+
+	double BestCost = MAX_dbl;
+	int32 MeetingNode = -1;
+
+	auto ExpandForward = [&]()
+	{
+		int32 CurrentNodeIndex;
+		double CurrentKey;
+		if (!ForwardQueue->Dequeue(CurrentNodeIndex, CurrentKey)) { return; }
+
+		if (VisitedForward[CurrentNodeIndex]) { return; }
+		VisitedForward[CurrentNodeIndex] = true;
+
+		const PCGExCluster::FNode& Current = NodesRef[CurrentNodeIndex];
+		const double CurrentGScore = GForward[CurrentNodeIndex];
+
+		for (const PCGExGraph::FLink Lk : Current.Links)
+		{
+			const int32 NeighborIndex = Lk.Node;
+			if (VisitedForward[NeighborIndex]) { continue; }
+
+			const PCGExCluster::FNode& AdjacentNode = NodesRef[NeighborIndex];
+			const PCGExGraph::FEdge& Edge = EdgesRef[Lk.Edge];
+
+			const double TentativeGScore = CurrentGScore + Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, ForwardStack);
+
+			const double PreviousGScore = GForward[NeighborIndex];
+			if (PreviousGScore != -1 && TentativeGScore >= PreviousGScore) { continue; }
+
+			ForwardStack->Set(NeighborIndex, PCGEx::NH64(CurrentNodeIndex, Lk.Edge));
+			GForward[NeighborIndex] = TentativeGScore;
+			ForwardQueue->Enqueue(NeighborIndex, TentativeGScore + GetPotential(AdjacentNode));
+
+			const double OtherGScore = GBackward[NeighborIndex];
+			if (OtherGScore != -1 && TentativeGScore + OtherGScore < BestCost)
+			{
+				BestCost = TentativeGScore + OtherGScore;
+				MeetingNode = NeighborIndex;
+			}
+		}
+	};
+
+	auto ExpandBackward = [&]()
+	{
+		int32 CurrentNodeIndex;
+		double CurrentKey;
+		if (!BackwardQueue->Dequeue(CurrentNodeIndex, CurrentKey)) { return; }
+
+		if (VisitedBackward[CurrentNodeIndex]) { return; }
+		VisitedBackward[CurrentNodeIndex] = true;
+
+		const PCGExCluster::FNode& Current = NodesRef[CurrentNodeIndex];
+		const double CurrentGScore = GBackward[CurrentNodeIndex];
+
+		for (const PCGExGraph::FLink Lk : Current.Links)
+		{
+			const int32 NeighborIndex = Lk.Node;
+			if (VisitedBackward[NeighborIndex]) { continue; }
+
+			const PCGExCluster::FNode& AdjacentNode = NodesRef[NeighborIndex];
+			const PCGExGraph::FEdge& Edge = EdgesRef[Lk.Edge];
+
+			// The path travels Adjacent -> Current; score the edge in that direction
+			const double TentativeGScore = CurrentGScore + Heuristics->GetEdgeScore(AdjacentNode, Current, Edge, SeedNode, GoalNode, Feedback);
+
+			const double PreviousGScore = GBackward[NeighborIndex];
+			if (PreviousGScore != -1 && TentativeGScore >= PreviousGScore) { continue; }
+
+			BackwardStack->Set(NeighborIndex, PCGEx::NH64(CurrentNodeIndex, Lk.Edge));
+			GBackward[NeighborIndex] = TentativeGScore;
+			BackwardQueue->Enqueue(NeighborIndex, TentativeGScore - GetPotential(AdjacentNode));
+
+			const double OtherGScore = GForward[NeighborIndex];
+			if (OtherGScore != -1 && TentativeGScore + OtherGScore < BestCost)
+			{
+				BestCost = TentativeGScore + OtherGScore;
+				MeetingNode = NeighborIndex;
+			}
+		}
+	};
+
+	while (true)
+	{
+		double TopForward = 0;
+		double TopBackward = 0;
+
+		// Once either front is exhausted, no shorter connection can be found
+		if (!ForwardQueue->Peek(TopForward) || !BackwardQueue->Peek(TopBackward)) { break; }
+
+		// Keys share the same potential offset, so this is the regular bidirectional stopping criterion
+		if (TopForward + TopBackward >= BestCost) { break; }
+
+		if (TopForward <= TopBackward) { ExpandForward(); }
+		else { ExpandBackward(); }
+	}
+
+	if (MeetingNode == -1) { return false; }
+
+	// Walk from the meeting node to the goal first, so nodes can be added goal-first like other searches do
+	TArray<int32> TailNodes;
+	TArray<int32> TailEdges;
+
+	int32 PathNodeIndex = MeetingNode;
+	int32 PathEdgeIndex = -1;
+
+	while (PathNodeIndex != GoalNode.Index)
+	{
+		PCGEx::NH64(BackwardStack->Get(PathNodeIndex), PathNodeIndex, PathEdgeIndex);
+		if (PathNodeIndex == -1) { return false; }
+
+		TailNodes.Add(PathNodeIndex);
+		TailEdges.Add(PathEdgeIndex);
+	}
+
+	InQuery->AddPathNode(GoalNode.Index);
+	for (int i = TailNodes.Num() - 1; i > 0; i--) { InQuery->AddPathNode(TailNodes[i - 1], TailEdges[i]); }
+	if (!TailNodes.IsEmpty()) { InQuery->AddPathNode(MeetingNode, TailEdges[0]); }
+
+	PathNodeIndex = MeetingNode;
+	while (PathNodeIndex != SeedNode.Index)
+	{
+		PCGEx::NH64(ForwardStack->Get(PathNodeIndex), PathNodeIndex, PathEdgeIndex);
+		if (PathNodeIndex == -1) { return false; }
+
+		InQuery->AddPathNode(PathNodeIndex, PathEdgeIndex);
+	}
+
+	return true;
+}
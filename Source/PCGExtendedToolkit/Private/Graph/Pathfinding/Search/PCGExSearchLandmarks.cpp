@@ -0,0 +1,122 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+
+#include "Graph/Pathfinding/Search/PCGExSearchLandmarks.h"
+
+#include "Graph/PCGExCluster.h"
+#include "Graph/Pathfinding/Heuristics/PCGExHeuristics.h"
+#include "Graph/Pathfinding/Search/PCGExScoredQueue.h"
+
+void UPCGExSearchLandmarks::CopySettingsFrom(const UPCGExOperation* Other)
+{
+	Super::CopySettingsFrom(Other);
+	if (const UPCGExSearchLandmarks* TypedOther = Cast<UPCGExSearchLandmarks>(Other))
+	{
+		NumLandmarks = TypedOther->NumLandmarks;
+	}
+}
+
+void UPCGExSearchLandmarks::PrepareForCluster(PCGExCluster::FCluster* InCluster)
+{
+	Super::PrepareForCluster(InCluster);
+	Landmarks = Cluster->GetLandmarks(NumLandmarks);
+}
+
+bool UPCGExSearchLandmarks::ResolveQuery(
+	const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
+	const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& Heuristics,
+	const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback) const
+{
+	check(InQuery->PickResolution == PCGExPathfinding::EQueryPickResolution::Success)
+
+	const TArray<PCGExCluster::FNode>& NodesRef = *Cluster->Nodes;
+	const TArray<PCGExGraph::FEdge>& EdgesRef = *Cluster->Edges;
+
+	const PCGExCluster::FNode& SeedNode = *InQuery->Seed.Node;
+	const PCGExCluster::FNode& GoalNode = *InQuery->Goal.Node;
+
+	const int32 NumNodes = NodesRef.Num();
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchLandmarks::FindPath);
+
+	// Landmarks bound the remaining path length; scale it to the lowest score a unit of length can cost
+	// so the estimate never exceeds the actual remaining score.
+	const PCGExCluster::FLandmarks* LandmarksPtr = Landmarks.Get();
+	const double ScorePerLength = Heuristics->GetMinScorePerLength();
+	const int32 GoalIndex = GoalNode.Index;
+
+	auto GetEstimate = [&](const int32 NodeIndex) { return LandmarksPtr->GetLowerBound(NodeIndex, GoalIndex) * ScorePerLength; };
+
+	TBitArray<> Visited;
+	Visited.Init(false, NumNodes);
+
+	const TSharedPtr<PCGEx::FHashLookup> TravelStack = PCGEx::NewHashLookup<PCGEx::FArrayHashLookup>(PCGEx::NH64(-1, -1), NumNodes);
+
+	TArray<double> GScore;
+	GScore.Init(-1, NumNodes);
+
+	const TUniquePtr<PCGExSearch::FScoredQueue> ScoredQueue = MakeUnique<PCGExSearch::FScoredQueue>(
+		NumNodes, SeedNode.Index, GetEstimate(SeedNode.Index));
+
+	GScore[SeedNode.Index] = 0;
+
+	const PCGExHeuristics::FLocalFeedbackHandler* Feedback = LocalFeedback.Get();
+
+	int32 CurrentNodeIndex;
+	double CurrentFScore;
+	while (ScoredQueue->Dequeue(CurrentNodeIndex, CurrentFScore))
+	{
+		if (bEarlyExit && CurrentNodeIndex == GoalIndex) { break; } // Exit early
+
+		const double CurrentGScore = GScore[CurrentNodeIndex];
+		const PCGExCluster::FNode& Current = NodesRef[CurrentNodeIndex];
+
+		if (Visited[CurrentNodeIndex]) { continue; }
+		Visited[CurrentNodeIndex] = true;
+
+		for (const PCGExGraph::FLink Lk : Current.Links)
+		{
+			const uint32 NeighborIndex = Lk.Node;
+			const uint32 EdgeIndex = Lk.Edge;
+
+			if (Visited[NeighborIndex]) { continue; }
+
+			const PCGExCluster::FNode& AdjacentNode = NodesRef[NeighborIndex];
+			const PCGExGraph::FEdge& Edge = EdgesRef[EdgeIndex];
+
+			const double EScore = Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStack);
+			const double TentativeGScore = CurrentGScore + EScore;
+
+			const double PreviousGScore = GScore[NeighborIndex];
+			if (PreviousGScore != -1 && TentativeGScore >= PreviousGScore) { continue; }
+
+			TravelStack->Set(NeighborIndex, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
+			GScore[NeighborIndex] = TentativeGScore;
+
+			ScoredQueue->Enqueue(NeighborIndex, TentativeGScore + GetEstimate(NeighborIndex));
+		}
+	}
+
+	bool bSuccess = false;
+
+	int32 PathNodeIndex = PCGEx::NH64A(TravelStack->Get(GoalIndex));
+	int32 PathEdgeIndex = -1;
+
+	if (PathNodeIndex != -1)
+	{
+		bSuccess = true;
+
+		InQuery->AddPathNode(GoalIndex);
+
+		while (PathNodeIndex != -1)
+		{
+			const int32 CurrentIndex = PathNodeIndex;
+			PCGEx::NH64(TravelStack->Get(CurrentIndex), PathNodeIndex, PathEdgeIndex);
+
+			InQuery->AddPathNode(CurrentIndex, PathEdgeIndex);
+		}
+	}
+
+	return bSuccess;
+}
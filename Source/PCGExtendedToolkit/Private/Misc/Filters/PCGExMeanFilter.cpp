@@ -3,6 +3,8 @@
 
 #include "Misc/Filters/PCGExMeanFilter.h"
 
+#include "PCGExStatsSketch.h"
+
 
 #define LOCTEXT_NAMESPACE "PCGExMeanFilterDefinition"
 #define PCGEX_NAMESPACE MeanFilterDefinition
@@ -32,7 +34,7 @@ bool PCGExPointFilter::FMeanFilter::Init(FPCGExContext* InContext, const TShared
 {
 	if (!FFilter::Init(InContext, InPointDataFacade)) { return false; }
 
-	const TSharedPtr<PCGExData::TBuffer<double>> Target = PointDataFacade->GetBroadcaster<double>(TypedFilterFactory->Config.Target, true);
+	Target = PointDataFacade->GetBroadcaster<double>(TypedFilterFactory->Config.Target, true);
 
 	if (!Target)
 	{
@@ -43,61 +45,84 @@ bool PCGExPointFilter::FMeanFilter::Init(FPCGExContext* InContext, const TShared
 	DataMin = Target->Min;
 	DataMax = Target->Max;
 
-	Values.Reserve(Target->GetInValues()->Num());
-	Values.Append(*Target->GetInValues());
-
 	return true;
 }
 
 void PCGExPointFilter::FMeanFilter::PostInit()
 {
+	const FPCGExMeanFilterConfig& Config = TypedFilterFactory->Config;
+
 	const int32 NumPoints = PointDataFacade->Source->GetNum();
 	Results.Init(false, NumPoints);
 
-	double SumValue = 0;
-	for (int i = 0; i < NumPoints; i++) { SumValue += Values[i]; }
+	const TArray<double>& Values = *Target->GetInValues();
 
-	if (TypedFilterFactory->Config.Measure == EPCGExMeanMeasure::Relative)
+	if (Config.Measure == EPCGExMeanMeasure::Relative)
 	{
-		double RelativeMinEdgeLength = MAX_dbl;
-		double RelativeMaxEdgeLength = MIN_dbl;
-		SumValue = 0;
-		for (int i = 0; i < NumPoints; i++)
-		{
-			const double Normalized = (Values[i] /= DataMax);
-			RelativeMinEdgeLength = FMath::Min(Normalized, RelativeMinEdgeLength);
-			RelativeMaxEdgeLength = FMath::Max(Normalized, RelativeMaxEdgeLength);
-			SumValue += Normalized;
-		}
-		DataMin = RelativeMinEdgeLength;
-		DataMax = RelativeMaxEdgeLength;
+		// Values are normalized on read instead of rewriting a copy of the buffer
+		Divider = DataMax;
+		const double RelativeMin = DataMin / Divider;
+		const double RelativeMax = DataMax / Divider;
+		DataMin = FMath::Min(RelativeMin, RelativeMax);
+		DataMax = FMath::Max(RelativeMin, RelativeMax);
 	}
 
-	switch (TypedFilterFactory->Config.MeanMethod)
+	// Filters are initialized synchronously, outside of any task group, so sketches are filled in a single streaming pass
+	const bool bSketch = Config.Precision == EPCGExStatsPrecision::Sketch;
+
+	auto GetNormalizedValues = [&]()
+	{
+		TArray<double> Normalized;
+		Normalized.SetNumUninitialized(NumPoints);
+		for (int i = 0; i < NumPoints; i++) { Normalized[i] = Values[i] / Divider; }
+		return Normalized;
+	};
+
+	switch (Config.MeanMethod)
 	{
 	default:
 	case EPCGExMeanMethod::Average:
-		ReferenceValue = SumValue / NumPoints;
+		if (bSketch && NumPoints > 0)
+		{
+			PCGExStats::FWelford Moments;
+			for (int i = 0; i < NumPoints; i++) { Moments.Add(Values[i]); }
+			ReferenceValue = Moments.Mean / Divider;
+		}
+		else
+		{
+			double SumValue = 0;
+			for (int i = 0; i < NumPoints; i++) { SumValue += Values[i] / Divider; }
+			ReferenceValue = SumValue / NumPoints;
+		}
 		break;
 	case EPCGExMeanMethod::Median:
-		ReferenceValue = PCGExMath::GetMedian(Values);
+		if (bSketch && NumPoints > 0)
+		{
+			PCGExStats::FTDigest Digest;
+			for (int i = 0; i < NumPoints; i++) { Digest.Add(Values[i]); }
+			ReferenceValue = Digest.Quantile(0.5) / Divider;
+		}
+		else
+		{
+			ReferenceValue = PCGExMath::GetMedian(Values) / Divider;
+		}
 		break;
 	case EPCGExMeanMethod::Fixed:
-		ReferenceValue = TypedFilterFactory->Config.MeanValue;
+		ReferenceValue = Config.MeanValue;
 		break;
 	case EPCGExMeanMethod::ModeMin:
-		ReferenceValue = PCGExMath::GetMode(Values, false, TypedFilterFactory->Config.ModeTolerance);
+		ReferenceValue = PCGExMath::GetMode(GetNormalizedValues(), false, Config.ModeTolerance);
 		break;
 	case EPCGExMeanMethod::ModeMax:
-		ReferenceValue = PCGExMath::GetMode(Values, true, TypedFilterFactory->Config.ModeTolerance);
+		ReferenceValue = PCGExMath::GetMode(GetNormalizedValues(), true, Config.ModeTolerance);
 		break;
 	case EPCGExMeanMethod::Central:
 		ReferenceValue = DataMin + (DataMax - DataMin) * 0.5;
 		break;
 	}
 
-	const double RMin = TypedFilterFactory->Config.bDoExcludeBelowMean ? ReferenceValue - TypedFilterFactory->Config.ExcludeBelow : MIN_dbl_neg;
-	const double RMax = TypedFilterFactory->Config.bDoExcludeAboveMean ? ReferenceValue + TypedFilterFactory->Config.ExcludeAbove : MAX_dbl;
+	const double RMin = Config.bDoExcludeBelowMean ? ReferenceValue - Config.ExcludeBelow : MIN_dbl_neg;
+	const double RMax = Config.bDoExcludeAboveMean ? ReferenceValue + Config.ExcludeAbove : MAX_dbl;
 
 	ReferenceMin = FMath::Min(RMin, RMax);
 	ReferenceMax = FMath::Max(RMin, RMax);
@@ -105,7 +130,7 @@ void PCGExPointFilter::FMeanFilter::PostInit()
 
 bool PCGExPointFilter::FMeanFilter::Test(const int32 PointIndex) const
 {
-	return FMath::IsWithin(Values[PointIndex], ReferenceMin, ReferenceMax);
+	return FMath::IsWithin(Target->Read(PointIndex) / Divider, ReferenceMin, ReferenceMax);
 }
 
 PCGEX_CREATE_FILTER_FACTORY(Mean)
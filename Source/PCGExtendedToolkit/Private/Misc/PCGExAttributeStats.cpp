@@ -222,15 +222,63 @@ namespace PCGExAttributeStats
 
 	void FProcessor::CompleteWork()
 	{
-		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, AttributeStatProcessing)
-		AttributeStatProcessing->OnSubLoopStartCallback =
+		if (Settings->Precision == EPCGExStatsPrecision::Sketch && !Settings->NeedsExactCounts() && PointDataFacade->GetNum() > 0)
+		{
+			for (const TSharedPtr<FAttributeStatsBase>& Stat : Stats)
+			{
+				if (Stat->PrepareSketch(PointDataFacade)) { SketchStats.Add(Stat); }
+				else { ExactStats.Add(Stat); }
+			}
+		}
+		else
+		{
+			ExactStats = Stats;
+		}
+
+		if (!ExactStats.IsEmpty())
+		{
+			PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, AttributeStatProcessing)
+			AttributeStatProcessing->OnSubLoopStartCallback =
+				[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+				{
+					PCGEX_ASYNC_THIS
+					This->ExactStats[Scope.Start]->Process(This->PointDataFacade, This->Context, This->Settings, This->PointFilterCache);
+				};
+
+			AttributeStatProcessing->StartSubLoops(ExactStats.Num(), 1);
+		}
+
+		if (SketchStats.IsEmpty()) { return; }
+
+		// All sketched attributes are processed together, one pass over points per scope.
+		// Scope count is kept low as each scope owns its own set of distinct-count registers.
+		const int32 NumPoints = PointDataFacade->GetNum();
+		const int32 ChunkSize = FMath::Max(GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize(), FMath::DivideAndRoundUp(NumPoints, 64));
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, AttributeStatSketching)
+
+		AttributeStatSketching->OnPrepareSubLoopsCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops)
+			{
+				PCGEX_ASYNC_THIS
+				for (const TSharedPtr<FAttributeStatsBase>& Stat : This->SketchStats) { Stat->PrepareScopes(Loops.Num()); }
+			};
+
+		AttributeStatSketching->OnSubLoopStartCallback =
 			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
 			{
 				PCGEX_ASYNC_THIS
-				This->Stats[Scope.Start]->Process(This->PointDataFacade, This->Context, This->Settings, This->PointFilterCache);
+				for (const TSharedPtr<FAttributeStatsBase>& Stat : This->SketchStats) { Stat->ProcessScope(Scope, This->PointFilterCache); }
+			};
+
+		AttributeStatSketching->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				for (const TSharedPtr<FAttributeStatsBase>& Stat : This->SketchStats) { Stat->CompleteSketch(This->PointDataFacade, This->Context, This->Settings); }
 			};
 
-		AttributeStatProcessing->StartSubLoops(Stats.Num(), 1);
+		AttributeStatSketching->StartSubLoops(NumPoints, ChunkSize);
 	}
 }
 
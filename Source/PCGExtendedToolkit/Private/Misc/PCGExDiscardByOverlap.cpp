@@ -3,6 +3,8 @@
 
 #include "Misc/PCGExDiscardByOverlap.h"
 
+#include "Geometry/PCGExGeo.h"
+
 
 #define LOCTEXT_NAMESPACE "PCGExDiscardByOverlapElement"
 #define PCGEX_NAMESPACE DiscardByOverlap
@@ -50,26 +52,13 @@ void FPCGExOverlapScoresWeighting::Max(const FPCGExOverlapScoresWeighting& Other
 	CustomTagScore = FMath::Max(CustomTagScore, Other.CustomTagScore);
 }
 
-TSharedPtr<PCGExDiscardByOverlap::FOverlap> FPCGExDiscardByOverlapContext::RegisterOverlap(
-	PCGExDiscardByOverlap::FProcessor* InA,
-	PCGExDiscardByOverlap::FProcessor* InB,
-	const FBox& InIntersection)
+void FPCGExDiscardByOverlapContext::BatchProcessing_InitialProcessingDone()
 {
-	const uint64 HashID = PCGEx::H64U(InA->BatchIndex, InB->BatchIndex);
-
-	{
-		FReadScopeLock ReadScopeLock(OverlapLock);
-		if (TSharedPtr<PCGExDiscardByOverlap::FOverlap>* FoundPtr = OverlapMap.Find(HashID)) { return *FoundPtr; }
-	}
-
-	{
-		FWriteScopeLock WriteScopeLock(OverlapLock);
-		if (TSharedPtr<PCGExDiscardByOverlap::FOverlap>* FoundPtr = OverlapMap.Find(HashID)) { return *FoundPtr; }
+	FPCGExPointsProcessorContext::BatchProcessing_InitialProcessingDone();
 
-		PCGEX_MAKE_SHARED(NewOverlap, PCGExDiscardByOverlap::FOverlap, InA, InB, InIntersection)
-		OverlapMap.Add(HashID, NewOverlap);
-		return NewOverlap;
-	}
+	// 2 - Find overlaps between large bounds, we'll be searching only there.
+	const TSharedPtr<PCGExPointsMT::TBatch<PCGExDiscardByOverlap::FProcessor>> TypedBatch = StaticCastSharedPtr<PCGExPointsMT::TBatch<PCGExDiscardByOverlap::FProcessor>>(MainBatch);
+	PCGExGeo::RegisterOverlaps<PCGExDiscardByOverlap::FOverlap>(TypedBatch->Processors);
 }
 
 void FPCGExDiscardByOverlapContext::UpdateMaxScores(const TArray<PCGExDiscardByOverlap::FProcessor*>& InStack)
@@ -210,14 +199,6 @@ namespace PCGExDiscardByOverlap
 		HashID = PCGEx::H64U(InManager->BatchIndex, InManaged->BatchIndex);
 	}
 
-	void FProcessor::RegisterOverlap(FProcessor* InOtherProcessor, const FBox& Intersection)
-	{
-		FWriteScopeLock WriteScopeLock(RegistrationLock);
-		const TSharedPtr<FOverlap> Overlap = Context->RegisterOverlap(this, InOtherProcessor, Intersection);
-		if (Overlap->Manager == this) { ManagedOverlaps.Add(Overlap); }
-		Overlaps.Add(Overlap);
-	}
-
 	void FProcessor::RemoveOverlap(const TSharedPtr<FOverlap>& InOverlap, TArray<FProcessor*>& Stack)
 	{
 		Overlaps.Remove(InOverlap);
@@ -419,50 +400,21 @@ namespace PCGExDiscardByOverlap
 
 	void FProcessor::CompleteWork()
 	{
-		// 2 - Find overlaps between large bounds, we'll be searching only there.
+		// Overlaps have been registered by the context broadphase at this point
 
-		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, PreparationTask)
-		PreparationTask->OnCompleteCallback =
-			[PCGEX_ASYNC_THIS_CAPTURE]()
-			{
-				PCGEX_ASYNC_THIS
-
-				if (This->Settings->TestMode == EPCGExOverlapTestMode::Fast)
-				{
-					for (const TSharedPtr<FOverlap>& Overlap : This->Overlaps)
-					{
-						Overlap->Stats.OverlapCount = 1;
-						Overlap->Stats.OverlapVolume = Overlap->Intersection.GetVolume();
-					}
-				}
-				else
-				{
-					// Require one more expensive step...
-					if (!This->ManagedOverlaps.IsEmpty())
-					{
-						This->StartParallelLoopForRange(This->ManagedOverlaps.Num(), 8);
-					}
-				}
-			};
-
-		PreparationTask->OnIterationCallback =
-			[PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
+		if (Settings->TestMode == EPCGExOverlapTestMode::Fast)
+		{
+			for (const TSharedPtr<FOverlap>& Overlap : ManagedOverlaps)
 			{
-				PCGEX_ASYNC_THIS
-
-				const TSharedPtr<PCGExPointsMT::FPointsProcessorBatchBase> Parent = This->ParentBatch.Pin();
-				const TSharedPtr<PCGExData::FFacade> OtherFacade = Parent->ProcessorFacades[Index];
-				if (This->PointDataFacade == OtherFacade) { return; } // Skip self
-
-				const TSharedRef<FProcessor> OtherProcessor = StaticCastSharedRef<FProcessor>(*Parent->SubProcessorMap->Find(&OtherFacade->Source.Get()));
-
-				const FBox Intersection = This->Bounds.Overlap(OtherProcessor->GetBounds());
-				if (!Intersection.IsValid) { return; } // No overlap
-
-				This->RegisterOverlap(&OtherProcessor.Get(), Intersection);
-			};
-
-		PreparationTask->StartIterations(ParentBatch.Pin()->ProcessorFacades.Num(), 64);
+				Overlap->Stats.OverlapCount = 1;
+				Overlap->Stats.OverlapVolume = Overlap->Intersection.GetVolume();
+			}
+		}
+		else
+		{
+			// Require one more expensive step...
+			if (!ManagedOverlaps.IsEmpty()) { StartParallelLoopForRange(ManagedOverlaps.Num(), 8); }
+		}
 	}
 
 	void FProcessor::Write()
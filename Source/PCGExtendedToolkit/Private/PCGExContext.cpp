@@ -299,7 +299,7 @@ void FPCGExContext::LoadAssets()
 	}
 }
 
-UPCGManagedComponent* FPCGExContext::AttachManagedComponent(AActor* InParent, UActorComponent* InComponent, const FAttachmentTransformRules& AttachmentRules) const
+UPCGManagedComponent* FPCGExContext::AttachManagedComponent(AActor* InParent, UActorComponent* InComponent, const FAttachmentTransformRules& AttachmentRules, const TSubclassOf<UPCGManagedComponent>& InManagedClass) const
 {
 	UPCGComponent* SrcComp = SourceComponent.Get();
 
@@ -319,7 +319,7 @@ UPCGManagedComponent* FPCGExContext::AttachManagedComponent(AActor* InParent, UA
 	InComponent->ComponentTags.Add(SrcComp->GetFName());
 	InComponent->ComponentTags.Add(PCGHelpers::DefaultPCGTag);
 
-	UPCGManagedComponent* ManagedComponent = NewObject<UPCGManagedComponent>(SrcComp);
+	UPCGManagedComponent* ManagedComponent = NewObject<UPCGManagedComponent>(SrcComp, InManagedClass ? InManagedClass.Get() : UPCGManagedComponent::StaticClass());
 	ManagedComponent->GeneratedComponent = InComponent;
 	SrcComp->AddToManagedResources(ManagedComponent);
 
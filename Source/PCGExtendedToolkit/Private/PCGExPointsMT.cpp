@@ -106,6 +106,11 @@ namespace PCGExPointsMT
 	{
 		if (!PointDataFacade->IsDataValid(CurrentProcessingSource)) { return; }
 
+		if (CurrentProcessingSource == PCGExData::ESource::Out && PointDataFacade->Source->IsStreaming())
+		{
+			PointDataFacade->Source->StreamRange(Scope.Start, Scope.Count);
+		}
+
 		PrepareSingleLoopScopeForPoints(Scope);
 		TArray<FPCGPoint>& Points = PointDataFacade->Source->GetMutableData(CurrentProcessingSource)->GetMutablePoints();
 		for (int i = Scope.Start; i < Scope.End; i++) { ProcessSinglePoint(i, Points[i], Scope); }
@@ -53,3 +53,37 @@ void PCGExSorting::RegisterBuffersDependencies(FPCGExContext* InContext, PCGExDa
 {
 	for (const FPCGExSortRuleConfig& Rule : InRuleConfigs) { FacadePreloader.Register<double>(InContext, Rule.Selector); }
 }
+
+void PCGExSorting::RadixSort(TArray<uint32>& InOutValues)
+{
+	const int32 NumValues = InOutValues.Num();
+	if (NumValues <= 1) { return; }
+
+	TArray<uint32> Scratch;
+	Scratch.SetNumUninitialized(NumValues);
+
+	uint32* Src = InOutValues.GetData();
+	uint32* Dst = Scratch.GetData();
+
+	for (int32 Shift = 0; Shift < 32; Shift += 8)
+	{
+		int32 Offsets[256] = {};
+		for (int i = 0; i < NumValues; i++) { Offsets[(Src[i] >> Shift) & 0xFF]++; }
+
+		// All values share that byte, nothing to move
+		if (Offsets[(Src[0] >> Shift) & 0xFF] == NumValues) { continue; }
+
+		int32 Sum = 0;
+		for (int32& Offset : Offsets)
+		{
+			const int32 Count = Offset;
+			Offset = Sum;
+			Sum += Count;
+		}
+
+		for (int i = 0; i < NumValues; i++) { Dst[Offsets[(Src[i] >> Shift) & 0xFF]++] = Src[i]; }
+		Swap(Src, Dst);
+	}
+
+	if (Src != InOutValues.GetData()) { FMemory::Memcpy(InOutValues.GetData(), Src, NumValues * sizeof(uint32)); }
+}
@@ -0,0 +1,167 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExStatsSketch.h"
+
+namespace PCGExStats
+{
+	void FWelford::Merge(const FWelford& Other)
+	{
+		if (Other.Count == 0) { return; }
+		if (Count == 0)
+		{
+			*this = Other;
+			return;
+		}
+
+		const double CountA = static_cast<double>(Count);
+		const double CountB = static_cast<double>(Other.Count);
+		const double Total = CountA + CountB;
+		const double Delta = Other.Mean - Mean;
+
+		Mean += Delta * (CountB / Total);
+		M2 += Other.M2 + Delta * Delta * (CountA * CountB / Total);
+		Count += Other.Count;
+		Min = FMath::Min(Min, Other.Min);
+		Max = FMath::Max(Max, Other.Max);
+	}
+
+	FTDigest::FTDigest(const double InCompression)
+		: Compression(FMath::Max(10.0, InCompression))
+	{
+		MaxUnmerged = FMath::CeilToInt32(Compression * 5);
+		Centroids.Reserve(FMath::CeilToInt32(Compression * 2));
+		Unmerged.Reserve(MaxUnmerged);
+	}
+
+	void FTDigest::Add(const double Value, const double Weight)
+	{
+		Unmerged.Emplace(Value, Weight);
+		UnmergedWeight += Weight;
+		Min = FMath::Min(Min, Value);
+		Max = FMath::Max(Max, Value);
+
+		if (Unmerged.Num() >= MaxUnmerged) { Compress(); }
+	}
+
+	void FTDigest::Merge(const FTDigest& Other)
+	{
+		if (Other.IsEmpty()) { return; }
+
+		Unmerged.Append(Other.Centroids);
+		Unmerged.Append(Other.Unmerged);
+		UnmergedWeight += Other.GetTotalWeight();
+		Min = FMath::Min(Min, Other.Min);
+		Max = FMath::Max(Max, Other.Max);
+
+		Compress();
+	}
+
+	void FTDigest::Compress()
+	{
+		if (Unmerged.IsEmpty()) { return; }
+
+		Unmerged.Append(Centroids);
+		Unmerged.Sort([](const FCentroid& A, const FCentroid& B) { return A.Mean < B.Mean; });
+
+		const double TotalWeight = MergedWeight + UnmergedWeight;
+		const double Normalizer = 4 / Compression;
+
+		Centroids.Reset();
+
+		FCentroid Current = Unmerged[0];
+		double WeightSoFar = 0;
+
+		for (int i = 1; i < Unmerged.Num(); i++)
+		{
+			const FCentroid& Next = Unmerged[i];
+			const double Proposed = Current.Weight + Next.Weight;
+
+			// Centroid size bound from the q(1-q) scale: small near the tails, large around the median
+			const double Q0 = WeightSoFar / TotalWeight;
+			const double Q2 = (WeightSoFar + Proposed) / TotalWeight;
+			const double Limit = TotalWeight * FMath::Min(Q0 * (1 - Q0), Q2 * (1 - Q2)) * Normalizer;
+
+			if (Proposed <= Limit)
+			{
+				Current.Mean += (Next.Mean - Current.Mean) * (Next.Weight / Proposed);
+				Current.Weight = Proposed;
+			}
+			else
+			{
+				WeightSoFar += Current.Weight;
+				Centroids.Add(Current);
+				Current = Next;
+			}
+		}
+
+		Centroids.Add(Current);
+		Unmerged.Reset();
+
+		MergedWeight = TotalWeight;
+		UnmergedWeight = 0;
+	}
+
+	double FTDigest::Quantile(const double Q)
+	{
+		Compress();
+
+		if (Centroids.IsEmpty()) { return 0; }
+		if (Centroids.Num() == 1) { return Centroids[0].Mean; }
+
+		const double Index = FMath::Clamp(Q, 0.0, 1.0) * MergedWeight;
+
+		const FCentroid& First = Centroids[0];
+		if (Index < First.Weight * 0.5) { return FMath::Lerp(Min, First.Mean, Index / (First.Weight * 0.5)); }
+
+		const FCentroid& Last = Centroids.Last();
+		if (Index >= MergedWeight - Last.Weight * 0.5) { return FMath::Lerp(Last.Mean, Max, (Index - (MergedWeight - Last.Weight * 0.5)) / (Last.Weight * 0.5)); }
+
+		// Interpolate between neighboring centroids' centers of mass
+		double WeightSoFar = First.Weight * 0.5;
+		for (int i = 0; i < Centroids.Num() - 1; i++)
+		{
+			const FCentroid& A = Centroids[i];
+			const FCentroid& B = Centroids[i + 1];
+			const double Span = (A.Weight + B.Weight) * 0.5;
+
+			if (WeightSoFar + Span > Index) { return FMath::Lerp(A.Mean, B.Mean, (Index - WeightSoFar) / Span); }
+			WeightSoFar += Span;
+		}
+
+		return Last.Mean;
+	}
+
+	FHyperLogLog::FHyperLogLog(const int32 InPrecision)
+		: Precision(FMath::Clamp(InPrecision, 4, 18))
+	{
+		Registers.Init(0, 1 << Precision);
+	}
+
+	void FHyperLogLog::Merge(const FHyperLogLog& Other)
+	{
+		check(Other.Precision == Precision);
+		for (int i = 0; i < Registers.Num(); i++) { Registers[i] = FMath::Max(Registers[i], Other.Registers[i]); }
+	}
+
+	double FHyperLogLog::Estimate() const
+	{
+		const double M = static_cast<double>(Registers.Num());
+		const double Alpha = 0.7213 / (1 + 1.079 / M);
+
+		double Sum = 0;
+		int32 NumZeroes = 0;
+		for (const uint8 Register : Registers)
+		{
+			Sum += FMath::Pow(2.0, -static_cast<double>(Register));
+			if (Register == 0) { NumZeroes++; }
+		}
+
+		const double Raw = Alpha * M * M / Sum;
+
+		// Linear counting is far more accurate for small cardinalities
+		if (Raw <= 2.5 * M && NumZeroes > 0) { return M * FMath::Loge(M / static_cast<double>(NumZeroes)); }
+
+		return Raw;
+	}
+}
@@ -6,6 +6,7 @@
 #include "ISettingsModule.h"
 #endif
 #include "PCGExGlobalSettings.h"
+#include "Geometry/PCGExGeoMesh.h"
 
 #define LOCTEXT_NAMESPACE "FPCGExtendedToolkitModule"
 
@@ -29,6 +30,8 @@ void FPCGExtendedToolkitModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module
+	PCGExGeo::FlushMeshTopologyCache();
+
 #if WITH_EDITOR
 	if (ISettingsModule* SettingsModule = FModuleManager::GetModulePtr<ISettingsModule>("Settings"))
 	{
@@ -28,6 +28,9 @@ bool FPCGExBoundsPathIntersectionElement::Boot(FPCGExContext* InContext) const
 	Context->BoundsDataFacade = PCGExData::TryGetSingleFacade(InContext, PCGEx::SourceBoundsLabel, true);
 	if (!Context->BoundsDataFacade) { return false; }
 
+	Context->Cloud = Context->BoundsDataFacade->GetCloud(Settings->OutputSettings.BoundsSource, Settings->OutputSettings.InsideExpansion);
+	Context->Cloud->BuildBVH();
+
 	return true;
 }
 
@@ -97,8 +100,8 @@ namespace PCGExPathIntersections
 
 		bClosedLoop = Context->ClosedLoop.IsClosedLoop(PointDataFacade->Source);
 		LastIndex = PointDataFacade->GetNum() - 1;
-		Segmentation = MakeShared<PCGExGeo::FSegmentation>();
-		Cloud = Context->BoundsDataFacade->GetCloud(Settings->OutputSettings.BoundsSource, Settings->OutputSettings.InsideExpansion);
+		Cloud = Context->Cloud;
+		PCGEx::InitArray(SegmentIntersections, PointDataFacade->GetNum());
 
 		Details = Settings->OutputSettings;
 
@@ -120,8 +123,10 @@ namespace PCGExPathIntersections
 		return true;
 	}
 
-	void FProcessor::FindIntersections(const int32 Index) const
+	void FProcessor::FindIntersections(const int32 Index)
 	{
+		SegmentIntersections[Index] = nullptr;
+
 		int32 NextIndex = Index + 1;
 
 		if (Index == LastIndex)
@@ -139,13 +144,13 @@ namespace PCGExPathIntersections
 		if (Cloud->FindIntersections(Intersections.Get()))
 		{
 			Intersections->SortAndDedupe();
-			Segmentation->Insert(Intersections);
+			SegmentIntersections[Index] = Intersections;
 		}
 	}
 
 	void FProcessor::InsertIntersections(const int32 Index) const
 	{
-		const TSharedPtr<PCGExGeo::FIntersections> Intersections = Segmentation->IntersectionsList[Index];
+		const TSharedPtr<PCGExGeo::FIntersections> Intersections = SegmentIntersections[Index];
 		TArray<FPCGPoint>& MutablePoints = PointDataFacade->GetOut()->GetMutablePoints();
 		for (int i = 0; i < Intersections->Cuts.Num(); i++)
 		{
@@ -183,7 +188,9 @@ namespace PCGExPathIntersections
 
 	void FProcessor::CompleteWork()
 	{
-		const int32 NumCuts = Segmentation->GetNumCuts();
+		int32 NumCuts = 0;
+		for (const TSharedPtr<PCGExGeo::FIntersections>& Intersections : SegmentIntersections) { if (Intersections) { NumCuts += Intersections->Cuts.Num(); } }
+
 		if (NumCuts == 0)
 		{
 			if (Settings->OutputSettings.WillWriteAny())
@@ -212,46 +219,31 @@ namespace PCGExPathIntersections
 
 		UPCGMetadata* Metadata = PointDataFacade->GetOut()->Metadata;
 
+		// Segments are in path order and cuts are sorted along each segment,
+		// so a single pass merges original points & cuts into their final slots
 		int32 Idx = 0;
 
-		for (int i = 0; i < LastIndex; i++)
+		for (int i = 0; i <= LastIndex; i++)
 		{
 			const FPCGPoint& OriginalPoint = OriginalPoints[i];
 			MutablePoints[Idx++] = OriginalPoint;
 
-			if (const TSharedPtr<PCGExGeo::FIntersections> Intersections = Segmentation->Find(PCGEx::H64U(i, i + 1)))
-			{
-				Intersections->Start = Idx;
-				for (int j = 0; j < Intersections->Cuts.Num(); j++)
-				{
-					FPCGPoint& NewPoint = MutablePoints[Idx++] = OriginalPoint;
-					NewPoint.MetadataEntry = PCGInvalidEntryKey;
-					Metadata->InitializeOnSet(NewPoint.MetadataEntry);
-				}
-			}
-		}
-
-		const FPCGPoint& OriginalPoint = OriginalPoints[LastIndex];
-		MutablePoints[Idx++] = OriginalPoint;
+			const TSharedPtr<PCGExGeo::FIntersections>& Intersections = SegmentIntersections[i];
+			if (!Intersections) { continue; }
 
-		if (bClosedLoop)
-		{
-			if (const TSharedPtr<PCGExGeo::FIntersections> Intersections = Segmentation->Find(PCGEx::H64U(LastIndex, 0)))
+			Intersections->Start = Idx;
+			for (int j = 0; j < Intersections->Cuts.Num(); j++)
 			{
-				Intersections->Start = Idx;
-				for (int j = 0; j < Intersections->Cuts.Num(); j++)
-				{
-					FPCGPoint& NewPoint = MutablePoints[Idx++] = OriginalPoint;
-					NewPoint.MetadataEntry = PCGInvalidEntryKey;
-					Metadata->InitializeOnSet(NewPoint.MetadataEntry);
-				}
+				FPCGPoint& NewPoint = MutablePoints[Idx++] = OriginalPoint;
+				NewPoint.MetadataEntry = PCGInvalidEntryKey;
+				Metadata->InitializeOnSet(NewPoint.MetadataEntry);
 			}
 		}
 
 		PointDataFacade->Source->CleanupKeys();
 		Details.Init(PointDataFacade, Context->BoundsDataFacade);
 
-		Segmentation->ReduceToArray();
+		SegmentIntersections.RemoveAll([](const TSharedPtr<PCGExGeo::FIntersections>& Intersections) { return !Intersections; });
 
 		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, InsertionTaskGroup)
 
@@ -269,7 +261,7 @@ namespace PCGExPathIntersections
 				for (int i = Scope.Start; i < Scope.End; i++) { This->InsertIntersections(i); }
 			};
 
-		InsertionTaskGroup->StartSubLoops(Segmentation->IntersectionsList.Num(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+		InsertionTaskGroup->StartSubLoops(SegmentIntersections.Num(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
 
 		FPointsProcessor::CompleteWork();
 	}
@@ -4,6 +4,7 @@
 #include "Paths/PCGExCreateSpline.h"
 
 
+#include "PCGComponent.h"
 #include "Helpers/PCGHelpers.h"
 
 
@@ -36,9 +37,41 @@ bool FPCGExCreateSplineElement::Boot(FPCGExContext* InContext) const
 		PCGEX_VALIDATE_NAME_CONSUMABLE(Settings->LeaveTangentAttribute);
 	}
 
+	if (Settings->bUsePathIdAttribute) { PCGEX_VALIDATE_NAME_CONSUMABLE(Settings->PathIdAttribute); }
+
 	return true;
 }
 
+UPCGExManagedReusableComponent* FPCGExCreateSplineContext::PopReusableSpline(const int32 PathId)
+{
+	if (!bReusePoolInitialized)
+	{
+		bReusePoolInitialized = true;
+
+		// Gather splines that were soft-released by the previous generation of this node
+		if (UPCGComponent* SrcComp = SourceComponent.Get())
+		{
+			const uint64 OwnerUID = GetInputSettings<UPCGSettings>()->UID;
+
+			SrcComp->ForEachManagedResource(
+				[&](UPCGManagedResource* InResource)
+				{
+					UPCGExManagedReusableComponent* ManagedComponent = Cast<UPCGExManagedReusableComponent>(InResource);
+					if (!ManagedComponent || ManagedComponent->ReuseOwner != OwnerUID) { return; }
+					if (!ManagedComponent->IsMarkedUnused() || !IsValid(ManagedComponent->GetComponent<USplineComponent>())) { return; }
+
+					// Duplicate ids will simply be released once generation completes
+					if (!ReusePool.Contains(ManagedComponent->ReuseId)) { ReusePool.Add(ManagedComponent->ReuseId, ManagedComponent); }
+				});
+		}
+	}
+
+	TObjectPtr<UPCGExManagedReusableComponent> ManagedComponent = nullptr;
+	if (!ReusePool.RemoveAndCopyValue(PathId, ManagedComponent)) { return nullptr; }
+
+	return ManagedComponent;
+}
+
 bool FPCGExCreateSplineElement::ExecuteInternal(FPCGContext* InContext) const
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExCreateSplineElement::Execute);
@@ -125,6 +158,19 @@ namespace PCGExCreateSpline
 			}
 		}
 
+		PathId = PointDataFacade->Source->IOIndex;
+		if (Settings->bUsePathIdAttribute)
+		{
+			const TSharedPtr<PCGExData::TBuffer<int32>> PathIdReader = PointDataFacade->GetReadable<int32>(Settings->PathIdAttribute);
+			if (!PathIdReader)
+			{
+				PCGE_LOG_C(Warning, GraphAndLog, Context, FTEXT("Missing path id attribute"));
+				return false;
+			}
+
+			PathId = PathIdReader->Read(0);
+		}
+
 		PositionOffset = SplineActor->GetTransform().GetLocation();
 		SplineData = Context->ManagedObjects->New<UPCGSplineData>();
 		PCGEx::InitArray(SplinePoints, PointDataFacade->GetNum());
@@ -191,6 +237,27 @@ namespace PCGExCreateSpline
 			PointType);
 	}
 
+	void FProcessor::OnPointsProcessingComplete()
+	{
+		if (Settings->Mode == EPCGCreateSplineMode::CreateDataOnly || !Settings->bReuseComponents) { return; }
+
+		// Hash everything that ends up on the component, so unchanged paths can be skipped entirely on the game thread
+		ContentHash = HashCombineFast(GetTypeHash(bClosedLoop), GetTypeHash(PositionOffset));
+		for (const FSplinePoint& SplinePoint : SplinePoints)
+		{
+			ContentHash = HashCombineFast(ContentHash, GetTypeHash(SplinePoint.Position));
+			ContentHash = HashCombineFast(ContentHash, GetTypeHash(SplinePoint.ArriveTangent));
+			ContentHash = HashCombineFast(ContentHash, GetTypeHash(SplinePoint.LeaveTangent));
+			ContentHash = HashCombineFast(ContentHash, FCrc::MemCrc32(&SplinePoint.Rotation, sizeof(FRotator)));
+			ContentHash = HashCombineFast(ContentHash, GetTypeHash(SplinePoint.Scale));
+			ContentHash = HashCombineFast(ContentHash, static_cast<uint32>(SplinePoint.Type.GetValue()));
+		}
+
+		TArray<FString> Tags = PointDataFacade->Source->Tags->FlattenToArray();
+		Tags.Sort();
+		for (const FString& Tag : Tags) { ContentHash = HashCombineFast(ContentHash, GetTypeHash(Tag)); }
+	}
+
 	void FProcessor::Output()
 	{
 		TPointsProcessor<FPCGExCreateSplineContext, UPCGExCreateSplineSettings>::Output();
@@ -207,6 +274,34 @@ namespace PCGExCreateSpline
 			bIsPreviewMode = ExecutionContext->SourceComponent.Get()->IsInPreviewMode();
 #endif
 
+			if (Settings->bReuseComponents)
+			{
+				if (UPCGExManagedReusableComponent* ManagedComponent = Context->PopReusableSpline(PathId))
+				{
+					USplineComponent* SplineComponent = ManagedComponent->GetComponent<USplineComponent>();
+					if (SplineComponent->GetOwner() == SplineActor && SplineComponent->HasAnyFlags(RF_Transient) == bIsPreviewMode)
+					{
+						ManagedComponent->MarkAsReused();
+
+						// Unchanged path, nothing to do
+						if (ManagedComponent->ContentHash == ContentHash) { return; }
+
+						SplineComponent->ComponentTags.Reset();
+						SplineComponent->ComponentTags.Add(ExecutionContext->SourceComponent->GetFName());
+						SplineComponent->ComponentTags.Add(PCGHelpers::DefaultPCGTag);
+						PointDataFacade->Source->Tags->DumpTo(SplineComponent->ComponentTags);
+
+						SplineData->ApplyTo(SplineComponent); // Swaps curves in place & updates spline once
+
+						ManagedComponent->ContentHash = ContentHash;
+						Context->NotifyActors.Add(SplineActor);
+						return;
+					}
+
+					// Mismatching owner or flags will let it be released along with other unused ones
+				}
+			}
+
 			const FString ComponentName = TEXT("PCGSplineComponent");
 			const EObjectFlags ObjectFlags = (bIsPreviewMode ? RF_Transient : RF_NoFlags);
 			USplineComponent* SplineComponent = NewObject<USplineComponent>(SplineActor, MakeUniqueObjectName(SplineActor, USplineComponent::StaticClass(), FName(ComponentName)), ObjectFlags);
@@ -215,7 +310,14 @@ namespace PCGExCreateSpline
 
 			SplineData->ApplyTo(SplineComponent);
 
-			Context->AttachManagedComponent(SplineActor, SplineComponent, Settings->AttachmentRules.GetRules());
+			if (UPCGExManagedReusableComponent* ManagedComponent = Cast<UPCGExManagedReusableComponent>(
+				Context->AttachManagedComponent(SplineActor, SplineComponent, Settings->AttachmentRules.GetRules(), UPCGExManagedReusableComponent::StaticClass())))
+			{
+				ManagedComponent->ReuseId = PathId;
+				ManagedComponent->ReuseOwner = Settings->UID;
+				ManagedComponent->ContentHash = ContentHash;
+			}
+
 			Context->NotifyActors.Add(SplineActor);
 		}
 	}
@@ -7,6 +7,13 @@
 #define LOCTEXT_NAMESPACE "PCGExFuseCollinearElement"
 #define PCGEX_NAMESPACE FuseCollinear
 
+UPCGExFuseCollinearSettings::UPCGExFuseCollinearSettings(
+	const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	bSupportWindowing = true;
+}
+
 PCGEX_INITIALIZE_ELEMENT(FuseCollinear)
 
 bool FPCGExFuseCollinearElement::Boot(FPCGExContext* InContext) const
@@ -86,12 +93,90 @@ namespace PCGExFuseCollinear
 
 		LastPosition = Path->GetPos(0);
 
+		if (Settings->Windowing.ShouldSplit(Path->NumPoints))
+		{
+			// The sequential walk only depends on the last kept position; windows warm it up over their halo
+			// and get fixed up during stitching if it didn't converge to the same state.
+			Windows = MakeShared<PCGExPaths::FPathWindows>(Path->NumPoints, Settings->Windowing.WindowSize, Settings->Windowing.HaloSize);
+			WindowResults.SetNum(Windows->Num());
+
+			PCGEX_ASYNC_GROUP_CHKD(AsyncManager, FilterTask)
+
+			FilterTask->OnCompleteCallback =
+				[PCGEX_ASYNC_THIS_CAPTURE]()
+				{
+					PCGEX_ASYNC_THIS
+					This->Windows->Process(
+						This->AsyncManager,
+						[AsyncThis](const PCGExPaths::FPathWindow& Window)
+						{
+							PCGEX_ASYNC_NESTED_THIS
+							NestedThis->ProcessWindow(Window);
+						});
+				};
+
+			FilterTask->OnSubLoopStartCallback =
+				[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+				{
+					PCGEX_ASYNC_THIS
+					This->PrepareSingleLoopScopeForPoints(Scope);
+				};
+
+			FilterTask->StartSubLoops(PointDataFacade->GetNum(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+			return true;
+		}
+
 		bInlineProcessPoints = true;
 		StartParallelLoopForPoints(PCGExData::ESource::In);
 
 		return true;
 	}
 
+	bool FProcessor::IsKept(const int32 Index, FVector& InOutLastPosition) const
+	{
+		const FVector CurrentPos = Path->GetPos(Index);
+
+		if (!PointFilterCache[Index]) // Otherwise kept as per filters
+		{
+			if (Settings->bFuseCollocated && FVector::DistSquared(InOutLastPosition, CurrentPos) <= Context->FuseDistSquared)
+			{
+				// Collocated points
+				return false;
+			}
+
+			// Use last position to avoid removing smooth arcs
+			const double Dot = FVector::DotProduct((CurrentPos - InOutLastPosition).GetSafeNormal(), Path->DirToNextPoint(Index));
+			if ((!Settings->bInvertThreshold && Dot > Context->DotThreshold) ||
+				(Settings->bInvertThreshold && Dot < Context->DotThreshold))
+			{
+				// Collinear with previous, keep moving
+				return false;
+			}
+		}
+
+		InOutLastPosition = CurrentPos;
+		return true;
+	}
+
+	void FProcessor::ProcessWindow(const PCGExPaths::FPathWindow& Window)
+	{
+		FWindowResult& Result = WindowResults[Window.Index];
+
+		// Assume the halo start was kept and walk up to the window
+		FVector HaloLastPosition = Path->GetPos(Window.HaloStart);
+		for (int i = Window.HaloStart + 1; i < Window.Start; i++) { IsKept(i, HaloLastPosition); }
+
+		Result.EntryPosition = HaloLastPosition;
+		WalkWindow(Window, Result, HaloLastPosition);
+	}
+
+	void FProcessor::WalkWindow(const PCGExPaths::FPathWindow& Window, FWindowResult& Result, FVector& InOutLastPosition) const
+	{
+		Result.Kept.Reset();
+		for (int i = Window.Start; i < Window.End; i++) { if (IsKept(i, InOutLastPosition)) { Result.Kept.Add(i); } }
+		Result.ExitPosition = InOutLastPosition;
+	}
+
 	void FProcessor::PrepareSingleLoopScopeForPoints(const PCGExMT::FScope& Scope)
 	{
 		PointDataFacade->Fetch(Scope);
@@ -104,40 +189,34 @@ namespace PCGExFuseCollinear
 
 	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope)
 	{
-#define PCGEX_INSERT_CURRENT_POINT\
-		OutPoints->Add_GetRef(Point);\
-		LastPosition = Path->GetPos(Index);
+		if (IsKept(Index, LastPosition)) { OutPoints->Add(Point); }
+	}
 
-		if (PointFilterCache[Index])
+	void FProcessor::CompleteWork()
+	{
+		if (Windows)
 		{
-			// Kept point, as per filters
-			PCGEX_INSERT_CURRENT_POINT
-			return;
-		}
+			// Stitch windows in order, re-walking those whose halo didn't converge toward the actual walk state
+			const TArray<FPCGPoint>& InPoints = PointDataFacade->GetIn()->GetPoints();
+			FVector WalkPosition = Path->GetPos(0);
 
-		const FVector CurrentPos = Path->GetPos(Index);
-		if (Settings->bFuseCollocated && FVector::DistSquared(LastPosition, CurrentPos) <= Context->FuseDistSquared)
-		{
-			// Collocated points
-			return;
-		}
+			for (int i = 0; i < WindowResults.Num(); i++)
+			{
+				FWindowResult& Result = WindowResults[i];
 
-		// Use last position to avoid removing smooth arcs
-		const double Dot = FVector::DotProduct((CurrentPos - LastPosition).GetSafeNormal(), Path->DirToNextPoint(Index));
-		if ((!Settings->bInvertThreshold && Dot > Context->DotThreshold) ||
-			(Settings->bInvertThreshold && Dot < Context->DotThreshold))
-		{
-			// Collinear with previous, keep moving
-			return;
-		}
+				if (Result.EntryPosition != WalkPosition)
+				{
+					Result.EntryPosition = WalkPosition;
+					WalkWindow(Windows->Windows[i], Result, WalkPosition);
+				}
 
-		PCGEX_INSERT_CURRENT_POINT
+				WalkPosition = Result.ExitPosition;
+				for (const int32 Index : Result.Kept) { OutPoints->Add(InPoints[Index]); }
+			}
 
-#undef PCGEX_INSERT_CURRENT_POINT
-	}
+			WindowResults.Empty();
+		}
 
-	void FProcessor::CompleteWork()
-	{
 		OutPoints->Shrink();
 		if (Settings->bOmitInvalidPathsFromOutput && OutPoints->Num() < 2)
 		{
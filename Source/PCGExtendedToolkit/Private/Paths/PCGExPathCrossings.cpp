@@ -40,6 +40,12 @@ bool FPCGExPathCrossingsElement::Boot(FPCGExContext* InContext) const
 	Context->Distances = PCGExDetails::MakeDistances();
 	Context->CrossingBlending = Settings->CrossingBlending;
 
+	if (Settings->SearchMode == EPCGExPathCrossingsSearchMode::Sweep)
+	{
+		Context->ProjectionDetails = Settings->ProjectionDetails;
+		Context->ProjectionDetails.Init(Context, nullptr);
+	}
+
 	Context->CanCutTag = PCGEx::StringTagFromName(Settings->CanCutTag);
 	Context->CanBeCutTag = PCGEx::StringTagFromName(Settings->CanBeCutTag);
 
@@ -64,7 +70,7 @@ bool FPCGExPathCrossingsElement::ExecuteInternal(FPCGContext* InContext) const
 
 		const bool bIsCanBeCutTagValid = PCGEx::IsValidStringTag(Context->CanBeCutTag);
 
-		if (!Context->StartBatchProcessingPoints<PCGExPointsMT::TBatch<PCGExPathCrossings::FProcessor>>(
+		if (!Context->StartBatchProcessingPoints<PCGExPathCrossings::FBatch>(
 			[&](const TSharedPtr<PCGExData::FPointIO>& Entry)
 			{
 				if (Entry->GetNum() < 2)
@@ -79,7 +85,7 @@ bool FPCGExPathCrossingsElement::ExecuteInternal(FPCGContext* InContext) const
 				}
 				return true;
 			},
-			[&](const TSharedPtr<PCGExPointsMT::TBatch<PCGExPathCrossings::FProcessor>>& NewBatch)
+			[&](const TSharedPtr<PCGExPathCrossings::FBatch>& NewBatch)
 			{
 				NewBatch->PrimaryOperation = Context->Blending;
 				//NewBatch->SetPointsFilterData(&Context->FilterFactories);
@@ -149,6 +155,10 @@ namespace PCGExPathCrossings
 
 				This->CanCutFilterManager.Reset();
 				This->CanBeCutFilterManager.Reset();
+
+				// Sweep mode relies on a single shared structure built by the batch, and needs the cut filter
+				if (This->Settings->SearchMode == EPCGExPathCrossingsSearchMode::Sweep) { return; }
+
 				This->Path->BuildPartialEdgeOctree(This->CanCut);
 				This->CanCut.Empty();
 			};
@@ -248,7 +258,16 @@ namespace PCGExPathCrossings
 		};
 
 		// Find crossings
-		if (bSelfIntersectionOnly)
+		if (const PCGExPaths::FPathEdgeSweep* EdgeSweep = Context->EdgeSweep.Get())
+		{
+			for (const PCGExPaths::FPathEdgeSweep::FEdgeRef& Candidate : EdgeSweep->GetCandidates(SweepIndex, Iteration))
+			{
+				OtherPath = EdgeSweep->GetPath(Candidate.Path);
+				CurrentIOIndex = OtherPath->IOIndex;
+				FindSplit(OtherPath->Edges[Candidate.Edge]);
+			}
+		}
+		else if (bSelfIntersectionOnly)
 		{
 			OtherPath = Path.Get();
 			Path->GetEdgeOctree()->FindElementsWithBoundsTest(
@@ -492,6 +511,81 @@ namespace PCGExPathCrossings
 			};
 		CrossBlendTask->StartSubLoops(Path->NumEdges, GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
 	}
+
+	FBatch::FBatch(FPCGExContext* InContext, const TArray<TWeakPtr<PCGExData::FPointIO>>& InPointsCollection)
+		: TBatch<FProcessor>(InContext, InPointsCollection)
+	{
+	}
+
+	void FBatch::CompleteWork()
+	{
+		PCGEX_TYPED_CONTEXT_AND_SETTINGS(PathCrossings)
+
+		if (Settings->SearchMode != EPCGExPathCrossingsSearchMode::Sweep)
+		{
+			TBatch<FProcessor>::CompleteWork();
+			return;
+		}
+
+		BuildEdgeSweep();
+	}
+
+	void FBatch::BuildEdgeSweep()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPathCrossings::BuildEdgeSweep);
+
+		PCGEX_TYPED_CONTEXT_AND_SETTINGS(PathCrossings)
+
+		Context->EdgeSweep = MakeShared<PCGExPaths::FPathEdgeSweep>(
+			Context->ProjectionDetails.ProjectionQuat,
+			Settings->IntersectionDetails.Tolerance,
+			Settings->bSelfIntersectionOnly,
+			Settings->IntersectionDetails.bEnableSelfIntersection);
+
+		for (const TSharedRef<FProcessor>& Processor : Processors)
+		{
+			if (!Processor->bIsProcessorValid) { continue; }
+			Processor->SweepIndex = Context->EdgeSweep->Add(Processor->Path, Processor->CanCut, Processor->CanBeCut, Processor->bCanCut, Processor->bCanBeCut);
+		}
+
+		Context->EdgeSweep->Prepare();
+
+		if (Context->EdgeSweep->Num() == 0)
+		{
+			Context->EdgeSweep->Compile();
+			TBatch<FProcessor>::CompleteWork();
+			return;
+		}
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, SweepTask)
+
+		SweepTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+
+				This->GetContext<FPCGExPathCrossingsContext>()->EdgeSweep->Compile();
+				for (const TSharedRef<FProcessor>& Processor : This->Processors) { Processor->CanCut.Empty(); }
+
+				This->TBatch<FProcessor>::CompleteWork();
+			};
+
+		SweepTask->OnPrepareSubLoopsCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops)
+			{
+				PCGEX_ASYNC_THIS
+				This->GetContext<FPCGExPathCrossingsContext>()->EdgeSweep->PrepareScopes(Loops);
+			};
+
+		SweepTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				This->GetContext<FPCGExPathCrossingsContext>()->EdgeSweep->Sweep(Scope);
+			};
+
+		SweepTask->StartSubLoops(Context->EdgeSweep->Num(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -3,7 +3,9 @@
 
 #include "Paths/PCGExPathSplineMesh.h"
 
+#include "PCGComponent.h"
 #include "PCGExHelpers.h"
+#include "Helpers/PCGHelpers.h"
 
 
 #include "Paths/PCGExPaths.h"
@@ -65,6 +67,13 @@ bool FPCGExPathSplineMeshElement::Boot(FPCGExContext* InContext) const
 
 	PCGEX_VALIDATE_NAME_CONSUMABLE(Settings->AssetPathAttributeName)
 
+	if (Settings->OutputMode != EPCGExSplineMeshOutputMode::Components)
+	{
+#define PCGEX_SEGMENT_DATA_VALIDATE(_NAME, _TYPE, _ACCESSOR) if (!FPCGMetadataAttributeBase::IsValidName(Settings->SegmentDataPrefix + TEXT(#_NAME))) { PCGE_LOG(Error, GraphAndLog, FTEXT("Invalid segment data prefix.")); return false; }
+		PCGEX_FOREACH_SPLINEMESH_SEGMENT_DATA(PCGEX_SEGMENT_DATA_VALIDATE)
+#undef PCGEX_SEGMENT_DATA_VALIDATE
+	}
+
 	if (Settings->WeightToAttribute == EPCGExWeightOutputMode::Raw ||
 		Settings->WeightToAttribute == EPCGExWeightOutputMode::Normalized)
 	{
@@ -83,6 +92,42 @@ void FPCGExPathSplineMeshContext::RegisterAssetDependencies()
 	MainCollection->GetAssetPaths(GetRequiredAssets(), PCGExAssetCollection::ELoadingFlags::Recursive);
 }
 
+UPCGExManagedReusableComponent* FPCGExPathSplineMeshContext::PopReusableSplineMesh(const AActor* InParent)
+{
+	if (!bReusePoolInitialized)
+	{
+		bReusePoolInitialized = true;
+
+		// Gather spline meshes that were soft-released by the previous generation
+		if (UPCGComponent* SrcComp = SourceComponent.Get())
+		{
+			SrcComp->ForEachManagedResource(
+				[&](UPCGManagedResource* InResource)
+				{
+					UPCGExManagedReusableComponent* ManagedComponent = Cast<UPCGExManagedReusableComponent>(InResource);
+					if (!ManagedComponent || !ManagedComponent->IsMarkedUnused()) { return; }
+
+					const USplineMeshComponent* SplineMeshComponent = ManagedComponent->GetComponent<USplineMeshComponent>();
+					if (!IsValid(SplineMeshComponent) || !SplineMeshComponent->GetOwner()) { return; }
+
+					ReusePool.FindOrAdd(SplineMeshComponent->GetOwner()).Add(ManagedComponent);
+				});
+		}
+	}
+
+	TArray<TObjectPtr<UPCGExManagedReusableComponent>>* Pool = ReusePool.Find(InParent);
+	if (!Pool) { return nullptr; }
+
+	while (!Pool->IsEmpty())
+	{
+		UPCGExManagedReusableComponent* ManagedComponent = Pool->Pop();
+		if (!IsValid(ManagedComponent->GetComponent<USplineMeshComponent>())) { continue; }
+		return ManagedComponent;
+	}
+
+	return nullptr;
+}
+
 void FPCGExPathSplineMeshElement::PostLoadAssetsDependencies(FPCGExContext* InContext) const
 {
 	PCGEX_CONTEXT_AND_SETTINGS(PathSplineMesh)
@@ -251,6 +296,14 @@ namespace PCGExPathSplineMesh
 		PathWriter = PointDataFacade->GetWritable<FString>(Settings->AssetPathAttributeName, PCGExData::EBufferInit::New);
 #endif
 
+		bEmitSegmentData = Settings->OutputMode != EPCGExSplineMeshOutputMode::Components;
+		if (bEmitSegmentData)
+		{
+#define PCGEX_SEGMENT_DATA_INIT(_NAME, _TYPE, _ACCESSOR) _NAME##Writer = PointDataFacade->GetWritable<_TYPE>(FName(Settings->SegmentDataPrefix + TEXT(#_NAME)), PCGExData::EBufferInit::New);
+			PCGEX_FOREACH_SPLINEMESH_SEGMENT_DATA(PCGEX_SEGMENT_DATA_INIT)
+#undef PCGEX_SEGMENT_DATA_INIT
+		}
+
 		DataTags = PointDataFacade->Source->Tags->FlattenToArrayOfNames();
 
 		StartParallelLoopForPoints();
@@ -378,6 +431,13 @@ namespace PCGExPathSplineMesh
 		if (UpGetter) { Segment.UpVector = UpGetter->Read(Index); }
 		else if (Settings->SplineMeshUpMode == EPCGExSplineMeshUpMode::Constant) { Segment.UpVector = Settings->SplineMeshUpVector; }
 		else { Segment.ComputeUpVectorFromTangents(); }
+
+		if (bEmitSegmentData)
+		{
+#define PCGEX_SEGMENT_DATA_WRITE(_NAME, _TYPE, _ACCESSOR) _NAME##Writer->GetMutable(Index) = Segment._ACCESSOR;
+			PCGEX_FOREACH_SPLINEMESH_SEGMENT_DATA(PCGEX_SEGMENT_DATA_WRITE)
+#undef PCGEX_SEGMENT_DATA_WRITE
+		}
 	}
 
 	void FProcessor::CompleteWork()
@@ -389,6 +449,8 @@ namespace PCGExPathSplineMesh
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExPathSplineMesh::FProcessor::Output);
 
+		if (Settings->OutputMode == EPCGExSplineMeshOutputMode::SegmentData) { return; }
+
 		// TODO : Resolve per-point target actor...? irk.
 		AActor* TargetActor = Settings->TargetActor.Get() ? Settings->TargetActor.Get() : ExecutionContext->GetTargetActor(nullptr);
 
@@ -398,16 +460,34 @@ namespace PCGExPathSplineMesh
 			return;
 		}
 
+		const EObjectFlags ObjectFlags = (bIsPreviewMode ? RF_Transient : RF_NoFlags);
+		const FAttachmentTransformRules AttachmentRules(EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, false);
+		const FName SourceComponentName = ExecutionContext->SourceComponent->GetFName();
+
+		// Everything but the component objects themselves has been resolved off-thread at this point;
+		// first update the components we can reuse in place, then create the missing ones & register them in one go.
+		TArray<USplineMeshComponent*> NewComponents;
+		NewComponents.Reserve(Segments.Num());
+
+		bool bAnyOutput = false;
+
 		for (int i = 0; i < Segments.Num(); i++)
 		{
 			const PCGExPaths::FSplineMeshSegment& Segment = Segments[i];
 			if (!Segment.MeshEntry) { continue; }
 
-			const EObjectFlags ObjectFlags = (bIsPreviewMode ? RF_Transient : RF_NoFlags);
-			USplineMeshComponent* SplineMeshComponent = NewObject<USplineMeshComponent>(
-				TargetActor, MakeUniqueObjectName(
-					TargetActor, USplineMeshComponent::StaticClass(),
-					Context->UniqueNameGenerator->Get(TEXT("PCGSplineMeshComponent_") + Segment.MeshEntry->Staging.Path.GetAssetName())), ObjectFlags);
+			UPCGExManagedReusableComponent* ManagedComponent = Settings->bReuseComponents ? Context->PopReusableSplineMesh(TargetActor) : nullptr;
+			USplineMeshComponent* SplineMeshComponent = ManagedComponent ? ManagedComponent->GetComponent<USplineMeshComponent>() : nullptr;
+			const bool bReused = SplineMeshComponent && SplineMeshComponent->HasAnyFlags(RF_Transient) == bIsPreviewMode;
+
+			if (!bReused)
+			{
+				// Rejected pooled components are never marked as reused, and get released along with other unused ones
+				SplineMeshComponent = NewObject<USplineMeshComponent>(
+					TargetActor, MakeUniqueObjectName(
+						TargetActor, USplineMeshComponent::StaticClass(),
+						Context->UniqueNameGenerator->Get(TEXT("PCGSplineMeshComponent_") + Segment.MeshEntry->Staging.Path.GetAssetName())), ObjectFlags);
+			}
 
 			/*
 			SplineMeshComponent->SetCollisionEnabled(ECollisionEnabled::Type::NoCollision);
@@ -428,19 +508,35 @@ namespace PCGExPathSplineMesh
 
 			if (!Segment.ApplyMesh(SplineMeshComponent))
 			{
-				SplineMeshComponent->MarkAsGarbage();
+				if (!bReused) { SplineMeshComponent->MarkAsGarbage(); }
 				continue;
 			}
 
+			if (bReused)
+			{
+				ManagedComponent->MarkAsReused();
+
+				// Reset tags to what AttachManagedComponent would have set
+				SplineMeshComponent->ComponentTags.Reset();
+				SplineMeshComponent->ComponentTags.Add(SourceComponentName);
+				SplineMeshComponent->ComponentTags.Add(PCGHelpers::DefaultPCGTag);
+			}
+
 			if (Settings->TaggingDetails.bForwardInputDataTags) { SplineMeshComponent->ComponentTags.Append(DataTags); }
 			if (!Segment.Tags.IsEmpty()) { SplineMeshComponent->ComponentTags.Append(Segment.Tags.Array()); }
 
-			Context->AttachManagedComponent(
-				TargetActor, SplineMeshComponent,
-				FAttachmentTransformRules(EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, false));
+			bAnyOutput = true;
 
-			Context->NotifyActors.Add(TargetActor);
+			if (bReused) { SplineMeshComponent->UpdateMesh(); }
+			else { NewComponents.Add(SplineMeshComponent); }
 		}
+
+		for (USplineMeshComponent* SplineMeshComponent : NewComponents)
+		{
+			Context->AttachManagedComponent(TargetActor, SplineMeshComponent, AttachmentRules, UPCGExManagedReusableComponent::StaticClass());
+		}
+
+		if (bAnyOutput) { Context->NotifyActors.Add(TargetActor); }
 	}
 }
 
@@ -76,6 +76,46 @@ FPCGExPathIntersectionDetails::FPCGExPathIntersectionDetails(const double InTole
 
 namespace PCGExPaths
 {
+	FPathWindows::FPathWindows(const int32 InNumPoints, const int32 InWindowSize, const int32 InHaloSize)
+		: NumPoints(InNumPoints)
+	{
+		const int32 WindowSize = FMath::Max(1, InWindowSize);
+		const int32 HaloSize = FMath::Max(0, InHaloSize);
+		const int32 NumWindows = FMath::Max(1, NumPoints / WindowSize); // Remainder is spread over the last window
+
+		Windows.SetNum(NumWindows);
+		for (int i = 0; i < NumWindows; i++)
+		{
+			FPathWindow& Window = Windows[i];
+			Window.Index = i;
+			Window.Start = i * WindowSize;
+			Window.End = i == NumWindows - 1 ? NumPoints : Window.Start + WindowSize;
+			Window.HaloStart = FMath::Max(0, Window.Start - HaloSize);
+		}
+	}
+
+	void FPathWindows::Process(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager, TFunction<void(const FPathWindow&)>&& ProcessWindow, TFunction<void()>&& OnComplete)
+	{
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, ProcessWindowsTask)
+
+		if (OnComplete)
+		{
+			ProcessWindowsTask->OnCompleteCallback =
+				[OnComplete = MoveTemp(OnComplete)]()
+				{
+					OnComplete();
+				};
+		}
+
+		ProcessWindowsTask->OnSubLoopStartCallback =
+			[Self = AsShared(), ProcessWindow = MoveTemp(ProcessWindow)](const PCGExMT::FScope& Scope)
+			{
+				for (int i = Scope.Start; i < Scope.End; i++) { ProcessWindow(Self->Windows[i]); }
+			};
+
+		ProcessWindowsTask->StartSubLoops(Windows.Num(), 1);
+	}
+
 	FPathMetrics::FPathMetrics(const FVector& InStart)
 	{
 		Add(InStart);
@@ -506,6 +546,160 @@ namespace PCGExPaths
 		GetMutable(Edge.Start) = PI;
 	}
 
+	FPathEdgeSweep::FPathEdgeSweep(const FQuat& InProjection, const double InTolerance, const bool InSelfIntersectionOnly, const bool InEnableSelfIntersection)
+		: Projection(InProjection),
+		  Tolerance(InTolerance),
+		  bSelfIntersectionOnly(InSelfIntersectionOnly),
+		  bEnableSelfIntersection(InSelfIntersectionOnly || InEnableSelfIntersection)
+	{
+	}
+
+	int32 FPathEdgeSweep::Add(const TSharedPtr<FPath>& InPath, const TArray<int8>& InCanCut, const TArray<int8>& InCanBeCut, const bool bInCanCut, const bool bInCanBeCut)
+	{
+		const int32 PathIndex = Paths.Add(InPath);
+		EdgeOffsets.Add(NumEdges);
+		NumEdges += InPath->NumEdges;
+
+		if (!bInCanCut && !bInCanBeCut) { return PathIndex; }
+
+		Items.Reserve(Items.Num() + InPath->NumEdges);
+
+		for (int i = 0; i < InPath->NumEdges; i++)
+		{
+			const FPathEdge& Edge = InPath->Edges[i];
+			if (!InPath->IsEdgeValid(Edge)) { continue; }
+
+			uint8 Flags = None;
+			if (bInCanCut && InCanCut[i]) { Flags |= CanCut; }
+			if (bInCanBeCut && InCanBeCut[i]) { Flags |= CanBeCut; }
+			if (Flags == None) { continue; }
+
+			FSweepEdge& Item = Items.Emplace_GetRef();
+			Item.A = FVector2D(Projection.RotateVector(InPath->GetPos_Unsafe(Edge.Start)));
+			Item.B = FVector2D(Projection.RotateVector(InPath->GetPos_Unsafe(Edge.End)));
+			Item.Box += Item.A;
+			Item.Box += Item.B;
+			Item.Box = Item.Box.ExpandBy(Tolerance);
+			Item.Length = FVector2D::Distance(Item.A, Item.B);
+			Item.Path = PathIndex;
+			Item.Edge = i;
+			Item.Flags = Flags;
+		}
+
+		return PathIndex;
+	}
+
+	void FPathEdgeSweep::Prepare()
+	{
+		// Tie-break on path & edge so the sweep order, and thus the candidate order, is deterministic
+		Items.Sort(
+			[](const FSweepEdge& A, const FSweepEdge& B)
+			{
+				if (A.Box.Min.X != B.Box.Min.X) { return A.Box.Min.X < B.Box.Min.X; }
+				if (A.Path != B.Path) { return A.Path < B.Path; }
+				return A.Edge < B.Edge;
+			});
+	}
+
+	void FPathEdgeSweep::PrepareScopes(const TArray<PCGExMT::FScope>& Loops)
+	{
+		ScopedPairs = MakeShared<PCGExMT::TScopedArray<uint64>>(Loops);
+	}
+
+	void FPathEdgeSweep::Sweep(const PCGExMT::FScope& Scope)
+	{
+		TArray<uint64>& Pairs = ScopedPairs->Get_Ref(Scope);
+
+		const int32 NumItems = Items.Num();
+		for (int i = Scope.Start; i < Scope.End; i++)
+		{
+			const FSweepEdge& Item = Items[i];
+
+			for (int j = i + 1; j < NumItems; j++)
+			{
+				const FSweepEdge& Other = Items[j];
+
+				if (Other.Box.Min.X > Item.Box.Max.X) { break; } // Past the sweep line, nothing further can overlap
+				if (Other.Box.Min.Y > Item.Box.Max.Y || Other.Box.Max.Y < Item.Box.Min.Y) { continue; }
+
+				const bool bItemIsCut = (Item.Flags & CanBeCut) && (Other.Flags & CanCut);
+				const bool bOtherIsCut = (Other.Flags & CanBeCut) && (Item.Flags & CanCut);
+				if (!bItemIsCut && !bOtherIsCut) { continue; }
+
+				if (Item.Path == Other.Path)
+				{
+					if (!bEnableSelfIntersection) { continue; }
+					const FPath* Path = Paths[Item.Path].Get();
+					if (Path->Edges[Item.Edge].ShareIndices(Path->Edges[Other.Edge])) { continue; }
+				}
+				else if (bSelfIntersectionOnly)
+				{
+					continue;
+				}
+
+				if (AreSeparated(Item, Other) || AreSeparated(Other, Item)) { continue; }
+
+				if (bItemIsCut) { Pairs.Add(PCGEx::H64(i, j)); }
+				if (bOtherIsCut) { Pairs.Add(PCGEx::H64(j, i)); }
+			}
+		}
+	}
+
+	void FPathEdgeSweep::Compile()
+	{
+		CandidateOffsets.Init(0, NumEdges + 1);
+
+		if (!ScopedPairs) { return; }
+
+		ScopedPairs->ForEach(
+			[&](const TArray<uint64>& Pairs)
+			{
+				for (const uint64 Pair : Pairs)
+				{
+					const FSweepEdge& Item = Items[PCGEx::H64A(Pair)];
+					CandidateOffsets[EdgeOffsets[Item.Path] + Item.Edge + 1]++;
+				}
+			});
+
+		for (int i = 1; i <= NumEdges; i++) { CandidateOffsets[i] += CandidateOffsets[i - 1]; }
+
+		TArray<int32> Cursors;
+		Cursors.Append(CandidateOffsets.GetData(), NumEdges);
+		Candidates.SetNumUninitialized(CandidateOffsets.Last());
+
+		ScopedPairs->ForEach(
+			[&](const TArray<uint64>& Pairs)
+			{
+				for (const uint64 Pair : Pairs)
+				{
+					const FSweepEdge& Item = Items[PCGEx::H64A(Pair)];
+					const FSweepEdge& Other = Items[PCGEx::H64B(Pair)];
+					Candidates[Cursors[EdgeOffsets[Item.Path] + Item.Edge]++] = FEdgeRef(Other.Path, Other.Edge);
+				}
+			});
+
+		ScopedPairs.Reset();
+	}
+
+	TArrayView<const FPathEdgeSweep::FEdgeRef> FPathEdgeSweep::GetCandidates(const int32 PathIndex, const int32 EdgeIndex) const
+	{
+		const int32 Index = EdgeOffsets[PathIndex] + EdgeIndex;
+		return MakeArrayView(Candidates.GetData() + CandidateOffsets[Index], CandidateOffsets[Index + 1] - CandidateOffsets[Index]);
+	}
+
+	bool FPathEdgeSweep::AreSeparated(const FSweepEdge& Item, const FSweepEdge& Other) const
+	{
+		// Both endpoints of Other strictly on the same side of Item's supporting line, and farther than tolerance
+		const FVector2D Dir = Item.B - Item.A;
+		const double OA = FVector2D::CrossProduct(Dir, Other.A - Item.A);
+		const double OB = FVector2D::CrossProduct(Dir, Other.B - Item.A);
+
+		if ((OA > 0) != (OB > 0) || OA == 0 || OB == 0) { return false; }
+
+		const double Threshold = Tolerance * Item.Length;
+		return FMath::Abs(OA) > Threshold && FMath::Abs(OB) > Threshold;
+	}
+
 	TSharedPtr<FPath> MakePath(const TArrayView<const FPCGPoint> InPoints, const double Expansion, const bool bClosedLoop)
 	{
 		if (bClosedLoop)
@@ -4,6 +4,7 @@
 #include "Paths/PCGExResamplePath.h"
 
 #include "PCGExDataMath.h"
+#include "Algo/BinarySearch.h"
 
 
 #define LOCTEXT_NAMESPACE "PCGExResamplePathElement"
@@ -100,83 +101,72 @@ namespace PCGExResamplePath
 
 		SampleLength = PathLength->TotalLength / static_cast<double>(NumSamples - 1);
 
-		Samples.SetNumUninitialized(NumSamples);
-		bInlineProcessPoints = true;
+		LastPointIndex = InPoints.Num() - 1;
+		bClosedLoop = Path->IsClosedLoop();
+		bPreserveLastPoint = Settings->bPreserveLastPoint && !bClosedLoop;
 
-		int32 StartIndex = 0;
-		int32 EndIndex = 1;
-		FVector PrevPosition = InPoints[0].Transform.GetLocation();
-		double TraversedDistance = 0;
-
-		FPointSample& FirstSample = Samples[0];
-		FirstSample.Start = StartIndex;
-		FirstSample.End = EndIndex;
-		FirstSample.Location = PrevPosition;
-		FirstSample.Distance = TraversedDistance;
-
-		for (int i = 1; i < NumSamples; i++)
-		{
-			FPointSample& Sample = Samples[i];
-			Sample.Start = StartIndex;
+		MetadataBlender = MakeShared<PCGExDataBlending::FMetadataBlender>(&Settings->BlendingSettings);
+		MetadataBlender->PrepareForData(PointDataFacade);
 
-			FVector NextPosition = InPoints[EndIndex].Transform.GetLocation();
-			double DistToNext = FVector::Dist(PrevPosition, NextPosition);
-			double Remainder = SampleLength - DistToNext;
+		StartParallelLoopForPoints();
 
-			if (Remainder <= 0)
-			{
-				// Overshooting
-				PrevPosition = PrevPosition + (Path->DirToNextPoint(StartIndex) * SampleLength);
-				TraversedDistance += SampleLength;
-			}
-			else
-			{
-				PrevPosition = NextPosition;
+		return true;
+	}
 
-				while (Remainder > 0)
-				{
-					StartIndex = EndIndex++;
+	int32 FProcessor::FindSegment(const double Distance) const
+	{
+		// First segment whose end reaches the distance; a sample landing exactly on a point belongs to the segment ending there.
+		// Past the end of an open path, this returns the last point index.
+		if (Distance <= 0) { return 0; }
+		return Algo::LowerBound(PathLength->CumulativeLength, Distance);
+	}
 
-					if (EndIndex >= InPoints.Num())
-					{
-						if (!Path->IsClosedLoop())
-						{
-							EndIndex = InPoints.Num() - 1;
-							break;
-						}
+	void FProcessor::ComputeSample(const int32 Index, FPointSample& OutSample) const
+	{
+		if (Index == 0)
+		{
+			OutSample.Start = 0;
+			OutSample.End = 1;
+			OutSample.Location = Path->GetPos(0);
+			OutSample.Distance = 0;
+			return;
+		}
 
-						EndIndex = 0;
-					}
+		if (bPreserveLastPoint && Index == NumSamples - 1)
+		{
+			OutSample.Start = LastPointIndex - 1;
+			OutSample.End = LastPointIndex;
+			OutSample.Location = Path->GetPos(LastPointIndex);
+			OutSample.Distance = PathLength->TotalLength;
+			return;
+		}
 
-					NextPosition = InPoints[EndIndex].Transform.GetLocation();
-					DistToNext = FVector::Dist(PrevPosition, NextPosition);
+		auto WrapDistance = [&](double InDistance)
+		{
+			// Closed loops keep going around
+			if (bClosedLoop && InDistance > PathLength->TotalLength) { return InDistance - PathLength->TotalLength; }
+			return InDistance;
+		};
 
-					if (Remainder <= DistToNext) { PrevPosition = PrevPosition + (Path->DirToPrevPoint(EndIndex) * -Remainder); }
-					else { PrevPosition = NextPosition; }
-					Remainder -= DistToNext;
-				}
-			}
+		const double Distance = WrapDistance(SampleLength * Index);
+		const int32 Segment = FindSegment(Distance);
 
-			Sample.End = EndIndex;
-			Sample.Location = PrevPosition;
-			Sample.Distance = TraversedDistance;
-		}
+		// Sample start is the segment the previous sample landed on
+		OutSample.Start = FindSegment(WrapDistance(SampleLength * (Index - 1)));
+		OutSample.Distance = Distance;
 
-		if (Settings->bPreserveLastPoint && !Path->IsClosedLoop())
+		if (Segment >= PathLength->CumulativeLength.Num())
 		{
-			FPointSample& LastSample = Samples.Last();
-			LastSample.Start = InPoints.Num() - 2;
-			LastSample.End = InPoints.Num() - 1;
-			LastSample.Location = InPoints.Last().Transform.GetLocation();
-			LastSample.Distance = TraversedDistance;
+			// Overshooting an open path
+			OutSample.End = LastPointIndex;
+			OutSample.Location = Path->GetPos(LastPointIndex);
+			return;
 		}
 
-		MetadataBlender = MakeShared<PCGExDataBlending::FMetadataBlender>(&Settings->BlendingSettings);
-		MetadataBlender->PrepareForData(PointDataFacade);
+		const double SegmentStart = Segment == 0 ? 0 : PathLength->CumulativeLength[Segment - 1];
 
-		StartParallelLoopForPoints();
-
-		return true;
+		OutSample.End = Segment + 1 > LastPointIndex ? 0 : Segment + 1;
+		OutSample.Location = Path->GetPos(Segment) + Path->DirToNextPoint(Segment) * (Distance - SegmentStart);
 	}
 
 	void FProcessor::PrepareSingleLoopScopeForPoints(const PCGExMT::FScope& Scope)
@@ -186,7 +176,9 @@ namespace PCGExResamplePath
 
 	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope)
 	{
-		const FPointSample& Sample = Samples[Index];
+		FPointSample Sample;
+		ComputeSample(Index, Sample);
+
 		Point.Transform.SetLocation(Sample.Location);
 
 		//if (SourcesRange == 1)
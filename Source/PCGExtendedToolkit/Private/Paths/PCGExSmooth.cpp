@@ -85,8 +85,16 @@ namespace PCGExSmooth
 		bClosedLoop = Context->ClosedLoop.IsClosedLoop(PointDataFacade->Source);
 		NumPoints = PointDataFacade->GetNum();
 
-		MetadataBlender = MakeShared<PCGExDataBlending::FMetadataBlender>(&Settings->BlendingSettings);
-		MetadataBlender->PrepareForData(PointDataFacade);
+		TypedOperation = Cast<UPCGExSmoothingOperation>(PrimaryOperation);
+
+		FallbackBlending = Settings->BlendingSettings;
+		TSet<FName> KernelAttributes;
+
+		EPCGExSmoothingKernel KernelType = EPCGExSmoothingKernel::Triangular;
+		if (TypedOperation->GetWindowedKernel(KernelType)) { InitKernel(KernelType, KernelAttributes); }
+
+		MetadataBlender = MakeShared<PCGExDataBlending::FMetadataBlender>(&FallbackBlending);
+		MetadataBlender->PrepareForData(PointDataFacade, PCGExData::ESource::In, true, &KernelAttributes);
 
 		if (Settings->InfluenceInput == EPCGExInputValueType::Attribute)
 		{
@@ -100,7 +108,7 @@ namespace PCGExSmooth
 
 		if (Settings->SmoothingAmountType == EPCGExInputValueType::Attribute)
 		{
-			Smoothing = PointDataFacade->GetScopedBroadcaster<double>(Settings->SmoothingAmountAttribute);
+			Smoothing = PointDataFacade->GetBroadcaster<double>(Settings->SmoothingAmountAttribute, true);
 			if (!Smoothing)
 			{
 				PCGEX_LOG_INVALID_SELECTOR_C(ExecutionContext, "Smoothing", Settings->SmoothingAmountAttribute)
@@ -108,13 +116,94 @@ namespace PCGExSmooth
 			}
 		}
 
-		TypedOperation = Cast<UPCGExSmoothingOperation>(PrimaryOperation);
+		PathState = TypedOperation->PrepareForPath(
+			PointDataFacade->Source,
+			Smoothing ? FMath::Max(0.0, Smoothing->Max) * Settings->ScaleSmoothingAmountAttribute : Settings->SmoothingAmountConstant,
+			bClosedLoop);
 
 		StartParallelLoopForPoints();
 
 		return true;
 	}
 
+	void FProcessor::InitKernel(const EPCGExSmoothingKernel InKernel, TSet<FName>& OutKernelAttributes)
+	{
+		Kernel = MakeShared<PCGExSmoothing::FWindowedKernel>(NumPoints, bClosedLoop);
+
+		// Only weighted & plain averages are linear, everything else keeps going through the blender sample by sample
+		auto IsLinear = [](const EPCGExDataBlendingType Blending) { return Blending == EPCGExDataBlendingType::Weight || Blending == EPCGExDataBlendingType::Average; };
+		auto GetKernel = [&](const EPCGExDataBlendingType Blending) { return Blending == EPCGExDataBlendingType::Average ? EPCGExSmoothingKernel::Box : InKernel; };
+
+		const FPCGExPropertiesBlendingDetails PropertiesDetails = Settings->BlendingSettings.GetPropertiesBlendingDetails();
+
+#define PCGEX_KERNEL_PROPERTY(_NAME, _TYPE, _GET, _SET)\
+		if (IsLinear(PropertiesDetails._NAME##Blending))\
+		{\
+			FallbackBlending.PropertiesOverrides.bOverride##_NAME = true;\
+			FallbackBlending.PropertiesOverrides._NAME##Blending = EPCGExDataBlendingType::None;\
+			KernelJobs.Add([this, PropertyKernel = GetKernel(PropertiesDetails._NAME##Blending)]()\
+			{\
+				const TArray<FPCGPoint>& InPoints = PointDataFacade->GetIn()->GetPoints();\
+				TArray<FPCGPoint>& OutPoints = PointDataFacade->GetMutablePoints();\
+				TArray<_TYPE> Values;\
+				Values.SetNumUninitialized(NumPoints);\
+				for (int i = 0; i < NumPoints; i++) { const FPCGPoint& Point = InPoints[i]; Values[i] = _GET; }\
+				Kernel->Apply<_TYPE>(PropertyKernel, Values, Values);\
+				for (int i = 0; i < NumPoints; i++) { if (!Kernel->Mask[i]) { continue; } FPCGPoint& Point = OutPoints[i]; const _TYPE& Value = Values[i]; _SET; }\
+			});\
+		}
+
+		PCGEX_KERNEL_PROPERTY(Density, float, Point.Density, Point.Density = Value)
+		PCGEX_KERNEL_PROPERTY(BoundsMin, FVector, Point.BoundsMin, Point.BoundsMin = Value)
+		PCGEX_KERNEL_PROPERTY(BoundsMax, FVector, Point.BoundsMax, Point.BoundsMax = Value)
+		PCGEX_KERNEL_PROPERTY(Color, FVector4, Point.Color, Point.Color = Value)
+		PCGEX_KERNEL_PROPERTY(Position, FVector, Point.Transform.GetLocation(), Point.Transform.SetLocation(Value))
+		PCGEX_KERNEL_PROPERTY(Scale, FVector, Point.Transform.GetScale3D(), Point.Transform.SetScale3D(Value))
+		PCGEX_KERNEL_PROPERTY(Steepness, float, Point.Steepness, Point.Steepness = Value)
+
+#undef PCGEX_KERNEL_PROPERTY
+
+		TArray<PCGEx::FAttributeIdentity> Identities;
+		PCGEx::FAttributeIdentity::Get(PointDataFacade->GetOut()->Metadata, Identities);
+		Settings->BlendingSettings.Filter(Identities);
+
+		for (const PCGEx::FAttributeIdentity& Identity : Identities)
+		{
+			if (PCGEx::IsPCGExAttribute(Identity.Name)) { continue; }
+
+			const EPCGExDataBlendingType* TypePtr = Settings->BlendingSettings.AttributesOverrides.Find(Identity.Name);
+			const EPCGExDataBlendingType Blending = TypePtr ? *TypePtr : Settings->BlendingSettings.DefaultBlending;
+			if (!IsLinear(Blending)) { continue; }
+
+			PCGEx::ExecuteWithRightType(
+				Identity.UnderlyingType, [&](auto DummyValue)
+				{
+					using T = decltype(DummyValue);
+					if constexpr (
+						std::is_same_v<T, float> || std::is_same_v<T, double> ||
+						std::is_same_v<T, FVector2D> || std::is_same_v<T, FVector> || std::is_same_v<T, FVector4>)
+					{
+						const TSharedPtr<PCGExData::TBuffer<T>> Buffer = PointDataFacade->GetReadable<T>(Identity.Name);
+						if (!Buffer || !PointDataFacade->GetWritable<T>(Identity.Name, PCGExData::EBufferInit::Inherit)) { return; }
+
+						OutKernelAttributes.Add(Identity.Name);
+						KernelJobs.Add(
+							[this, Buffer, AttributeKernel = GetKernel(Blending)]()
+							{
+								Kernel->Apply<T>(AttributeKernel, *Buffer->GetInValues(), *Buffer->GetOutValues());
+							});
+					}
+				});
+		}
+
+		bHasFallbackBlending = !FallbackBlending.GetPropertiesBlendingDetails().HasNoBlending() || OutKernelAttributes.Num() < Identities.Num();
+	}
+
+	void FProcessor::PrepareLoopScopesForPoints(const TArray<PCGExMT::FScope>& Loops)
+	{
+		ScopedScratch.SetNum(Loops.Num());
+	}
+
 	void FProcessor::PrepareSingleLoopScopeForPoints(const PCGExMT::FScope& Scope)
 	{
 		PointDataFacade->Fetch(Scope);
@@ -123,22 +212,49 @@ namespace PCGExSmooth
 
 	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope)
 	{
+		const double LocalSmoothing = Smoothing ? FMath::Clamp(Smoothing->Read(Index), 0, MAX_dbl) * Settings->ScaleSmoothingAmountAttribute : Settings->SmoothingAmountConstant;
+
+		// Filtered out points are not smoothed but still shape the kernel passes of their neighbors
+		if (Kernel) { Kernel->Radii[Index] = FMath::Max(0, static_cast<int32>(LocalSmoothing)); }
+
 		if (!PointFilterCache[Index]) { return; }
 
 		const TSharedRef<PCGExData::FPointIO>& PointIO = PointDataFacade->Source;
 
 		PCGExData::FPointRef PtRef = PointIO->GetOutPointRef(Index);
-		const double LocalSmoothing = Smoothing ? FMath::Clamp(Smoothing->Read(Index), 0, MAX_dbl) * Settings->ScaleSmoothingAmountAttribute : Settings->SmoothingAmountConstant;
 
 		if ((Settings->bPreserveEnd && Index == NumPoints - 1) ||
 			(Settings->bPreserveStart && Index == 0))
 		{
-			TypedOperation->SmoothSingle(PointIO, PtRef, LocalSmoothing, 0, MetadataBlender.Get(), bClosedLoop);
+			TypedOperation->SmoothSingle(PointIO, PtRef, LocalSmoothing, 0, MetadataBlender.Get(), bClosedLoop, PathState.Get(), ScopedScratch[Scope.LoopIndex]);
 			return;
 		}
 
 		const double LocalInfluence = Influence ? Influence->Read(Index) : Settings->InfluenceConstant;
-		TypedOperation->SmoothSingle(PointIO, PtRef, LocalSmoothing, LocalInfluence, MetadataBlender.Get(), bClosedLoop);
+
+		if (Kernel)
+		{
+			Kernel->Mask[Index] = LocalInfluence != 0 && Kernel->Radii[Index] > 0;
+			if (!bHasFallbackBlending) { return; }
+		}
+
+		TypedOperation->SmoothSingle(PointIO, PtRef, LocalSmoothing, LocalInfluence, MetadataBlender.Get(), bClosedLoop, PathState.Get(), ScopedScratch[Scope.LoopIndex]);
+	}
+
+	void FProcessor::OnPointsProcessingComplete()
+	{
+		if (KernelJobs.IsEmpty()) { return; }
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, KernelTask)
+
+		KernelTask->OnIterationCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				This->KernelJobs[Index]();
+			};
+
+		KernelTask->StartIterations(KernelJobs.Num(), 1);
 	}
 
 	void FProcessor::CompleteWork()
@@ -0,0 +1,181 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Paths/Smoothing/PCGExRadiusSmoothing.h"
+
+void UPCGExRadiusSmoothing::CopySettingsFrom(const UPCGExOperation* Other)
+{
+	Super::CopySettingsFrom(Other);
+	if (const UPCGExRadiusSmoothing* TypedOther = Cast<UPCGExRadiusSmoothing>(Other))
+	{
+		Distance = TypedOther->Distance;
+	}
+}
+
+TSharedPtr<PCGExSmoothing::FPathState> UPCGExRadiusSmoothing::PrepareForPath(const TSharedRef<PCGExData::FPointIO>& Path, const double MaxSmoothing, const bool bClosedLoop) const
+{
+	const TArray<FPCGPoint>& InPoints = Path->GetIn()->GetPoints();
+	const int32 NumPoints = InPoints.Num();
+
+	PCGEX_MAKE_SHARED(State, PCGExSmoothing::FRadiusPathState)
+
+	TArray<FVector>& Positions = State->Positions;
+	State->bLoop = bClosedLoop;
+
+	Positions.SetNumUninitialized(NumPoints);
+	for (int i = 0; i < NumPoints; i++) { Positions[i] = InPoints[i].Transform.GetLocation(); }
+
+	if (Distance == EPCGExRadiusSmoothingDistance::AlongPath)
+	{
+		TArray<double>& ArcLengths = State->ArcLengths;
+		ArcLengths.SetNumUninitialized(NumPoints);
+		ArcLengths[0] = 0;
+		for (int i = 1; i < NumPoints; i++) { ArcLengths[i] = ArcLengths[i - 1] + FVector::Dist(Positions[i - 1], Positions[i]); }
+		State->TotalLength = ArcLengths.Last() + (bClosedLoop ? FVector::Dist(Positions.Last(), Positions[0]) : 0);
+		return State;
+	}
+
+	// Counting sort of points into hashed cells, so neighbors of a cell are contiguous
+	State->CellSize = MaxSmoothing > 0 ? MaxSmoothing : 1;
+
+	const uint32 NumBuckets = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(NumPoints));
+	State->BucketMask = NumBuckets - 1;
+
+	TArray<FIntVector>& Cells = State->Cells;
+	TArray<int32>& BucketStarts = State->BucketStarts;
+
+	Cells.SetNumUninitialized(NumPoints);
+	BucketStarts.SetNumZeroed(NumBuckets + 1);
+
+	for (int i = 0; i < NumPoints; i++)
+	{
+		Cells[i] = State->GetCell(Positions[i]);
+		BucketStarts[State->GetBucket(Cells[i]) + 1]++;
+	}
+
+	for (uint32 b = 0; b < NumBuckets; b++) { BucketStarts[b + 1] += BucketStarts[b]; }
+
+	TArray<int32> Cursors(BucketStarts.GetData(), NumBuckets);
+	State->BucketEntries.SetNumUninitialized(NumPoints);
+	for (int i = 0; i < NumPoints; i++) { State->BucketEntries[Cursors[State->GetBucket(Cells[i])]++] = i; }
+
+	return State;
+}
+
+void UPCGExRadiusSmoothing::SmoothSingle(
+	const TSharedRef<PCGExData::FPointIO>& Path,
+	PCGExData::FPointRef& Target,
+	const double Smoothing,
+	const double Influence,
+	PCGExDataBlending::FMetadataBlender* MetadataBlender,
+	const bool bClosedLoop,
+	const PCGExSmoothing::FPathState* PathState,
+	PCGExSmoothing::FScratch& Scratch)
+{
+	if (Influence == 0 || Smoothing <= 0) { return; }
+
+	check(PathState)
+	const PCGExSmoothing::FRadiusPathState& State = *static_cast<const PCGExSmoothing::FRadiusPathState*>(PathState);
+
+	Scratch.Indices.Reset();
+	Scratch.Weights.Reset();
+
+	if (Distance == EPCGExRadiusSmoothingDistance::AlongPath) { GatherAlongPath(State, Target.Index, Smoothing, Influence, Scratch); }
+	else { GatherEuclidean(State, Target.Index, Smoothing, Influence, Scratch); }
+
+	if (Scratch.Indices.IsEmpty()) { return; }
+
+	MetadataBlender->PrepareForBlending(Target);
+
+	double TotalWeight = 0;
+	for (int i = 0; i < Scratch.Indices.Num(); i++)
+	{
+		MetadataBlender->Blend(Target, Path->GetInPointRef(Scratch.Indices[i]), Target, Scratch.Weights[i]);
+		TotalWeight += Scratch.Weights[i];
+	}
+
+	MetadataBlender->CompleteBlending(Target, Scratch.Indices.Num(), TotalWeight);
+}
+
+void UPCGExRadiusSmoothing::GatherEuclidean(const PCGExSmoothing::FRadiusPathState& State, const int32 Index, const double Radius, const double Influence, PCGExSmoothing::FScratch& Scratch)
+{
+	const FVector& Origin = State.Positions[Index];
+	const FIntVector OriginCell = State.GetCell(Origin);
+	const double RadiusSquared = Radius * Radius;
+	const int32 Reach = FMath::Max(1, FMath::CeilToInt32(Radius / State.CellSize));
+
+	for (int32 Z = -Reach; Z <= Reach; Z++)
+	{
+		for (int32 Y = -Reach; Y <= Reach; Y++)
+		{
+			for (int32 X = -Reach; X <= Reach; X++)
+			{
+				const FIntVector Cell = OriginCell + FIntVector(X, Y, Z);
+				const uint32 Bucket = State.GetBucket(Cell);
+
+				for (int32 e = State.BucketStarts[Bucket]; e < State.BucketStarts[Bucket + 1]; e++)
+				{
+					const int32 OtherIndex = State.BucketEntries[e];
+					if (OtherIndex == Index || State.Cells[OtherIndex] != Cell) { continue; } // Skip hash collisions
+
+					const double Dist = FVector::DistSquared(Origin, State.Positions[OtherIndex]);
+					if (Dist >= RadiusSquared) { continue; }
+
+					Scratch.Indices.Add(OtherIndex);
+					Scratch.Weights.Add((1 - (Dist / RadiusSquared)) * Influence);
+				}
+			}
+		}
+	}
+}
+
+void UPCGExRadiusSmoothing::GatherAlongPath(const PCGExSmoothing::FRadiusPathState& State, const int32 Index, const double Radius, const double Influence, PCGExSmoothing::FScratch& Scratch)
+{
+	const TArray<double>& ArcLengths = State.ArcLengths;
+	const double TotalLength = State.TotalLength;
+	const int32 NumPoints = ArcLengths.Num();
+	const double RadiusSquared = Radius * Radius;
+	const double Origin = ArcLengths[Index];
+
+	auto Add = [&](const int32 OtherIndex, const double Dist)
+	{
+		Scratch.Indices.Add(OtherIndex);
+		Scratch.Weights.Add((1 - ((Dist * Dist) / RadiusSquared)) * Influence);
+	};
+
+	if (!State.bLoop)
+	{
+		for (int32 i = Index + 1; i < NumPoints; i++)
+		{
+			const double Dist = ArcLengths[i] - Origin;
+			if (Dist >= Radius) { break; }
+			Add(i, Dist);
+		}
+
+		for (int32 i = Index - 1; i >= 0; i--)
+		{
+			const double Dist = Origin - ArcLengths[i];
+			if (Dist >= Radius) { break; }
+			Add(i, Dist);
+		}
+
+		return;
+	}
+
+	// Walk both ways around the loop, each point is reached once through its shortest side
+	for (int32 k = 1; k < NumPoints; k++)
+	{
+		const int32 i = (Index + k) % NumPoints;
+		const double Dist = i > Index ? ArcLengths[i] - Origin : TotalLength - Origin + ArcLengths[i];
+		if (Dist >= Radius || Dist > TotalLength - Dist) { break; }
+		Add(i, Dist);
+	}
+
+	for (int32 k = 1; k < NumPoints; k++)
+	{
+		const int32 i = (Index - k + NumPoints) % NumPoints;
+		const double Dist = i < Index ? Origin - ArcLengths[i] : Origin + TotalLength - ArcLengths[i];
+		if (Dist >= Radius || Dist >= TotalLength - Dist) { break; }
+		Add(i, Dist);
+	}
+}
@@ -3,30 +3,19 @@
 
 #include "Sampling/PCGExSampleOverlapStats.h"
 
+#include "Geometry/PCGExGeo.h"
+
 
 #define LOCTEXT_NAMESPACE "PCGExSampleOverlapStatsElement"
 #define PCGEX_NAMESPACE SampleOverlapStats
 
-TSharedPtr<PCGExSampleOverlapStats::FOverlap> FPCGExSampleOverlapStatsContext::RegisterOverlap(
-	PCGExSampleOverlapStats::FProcessor* InA,
-	PCGExSampleOverlapStats::FProcessor* InB,
-	const FBox& InIntersection)
+void FPCGExSampleOverlapStatsContext::BatchProcessing_InitialProcessingDone()
 {
-	const uint64 HashID = PCGEx::H64U(InA->BatchIndex, InB->BatchIndex);
-
-	{
-		FReadScopeLock ReadScopeLock(OverlapLock);
-		if (TSharedPtr<PCGExSampleOverlapStats::FOverlap>* FoundPtr = OverlapMap.Find(HashID)) { return *FoundPtr; }
-	}
+	FPCGExPointsProcessorContext::BatchProcessing_InitialProcessingDone();
 
-	{
-		FWriteScopeLock WriteScopeLock(OverlapLock);
-		if (TSharedPtr<PCGExSampleOverlapStats::FOverlap>* FoundPtr = OverlapMap.Find(HashID)) { return *FoundPtr; }
-
-		PCGEX_MAKE_SHARED(NewOverlap, PCGExSampleOverlapStats::FOverlap, InA, InB, InIntersection)
-		OverlapMap.Add(HashID, NewOverlap);
-		return NewOverlap;
-	}
+	// 2 - Find overlaps between large bounds, we'll be searching only there.
+	const TSharedPtr<PCGExPointsMT::TBatch<PCGExSampleOverlapStats::FProcessor>> TypedBatch = StaticCastSharedPtr<PCGExPointsMT::TBatch<PCGExSampleOverlapStats::FProcessor>>(MainBatch);
+	PCGExGeo::RegisterOverlaps<PCGExSampleOverlapStats::FOverlap>(TypedBatch->Processors);
 }
 
 void FPCGExSampleOverlapStatsContext::BatchProcessing_WorkComplete()
@@ -100,14 +89,6 @@ namespace PCGExSampleOverlapStats
 	{
 	}
 
-	void FProcessor::RegisterOverlap(FProcessor* InOtherProcessor, const FBox& Intersection)
-	{
-		FWriteScopeLock WriteScopeLock(RegistrationLock);
-		const TSharedPtr<FOverlap> Overlap = Context->RegisterOverlap(this, InOtherProcessor, Intersection);
-		if (Overlap->Primary == this) { ManagedOverlaps.Add(Overlap.ToSharedRef()); }
-		Overlaps.Add(Overlap.ToSharedRef());
-	}
-
 	bool FProcessor::Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager)
 	{
 		PointDataFacade->bSupportsScopedGet = Context->bScopedAttributeGet;
@@ -220,7 +201,7 @@ namespace PCGExSampleOverlapStats
 		// For each managed overlap, find per-point intersections
 
 		const TSharedPtr<FOverlap> Overlap = Overlaps[Index];
-		const bool bUpdateOverlap = ManagedOverlaps.Contains(Overlap);
+		const bool bUpdateOverlap = Overlap->Primary == this;
 		const TSharedRef<FProcessor> OtherProcessor = StaticCastSharedRef<FProcessor>(*ParentBatch.Pin()->SubProcessorMap->Find(&Overlap->GetOther(this)->PointDataFacade->Source.Get()));
 
 		if (Settings->TestMode != EPCGExOverlapTestMode::Sphere)
@@ -313,58 +294,31 @@ namespace PCGExSampleOverlapStats
 
 	void FProcessor::CompleteWork()
 	{
-		// 2 - Find overlaps between large bounds, we'll be searching only there.
+		// Overlaps have been registered by the context broadphase at this point
+
+		if (Overlaps.IsEmpty()) { return; }
 
-		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, PreparationTask)
-		PreparationTask->OnCompleteCallback =
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, SearchTask)
+
+		SearchTask->OnCompleteCallback =
 			[PCGEX_ASYNC_THIS_CAPTURE]()
 			{
 				PCGEX_ASYNC_THIS
-				auto WrapUp = [AsyncThis]()
+				for (int i = 0; i < This->NumPoints; i++)
 				{
-					PCGEX_ASYNC_NESTED_THIS
-					for (int i = 0; i < NestedThis->NumPoints; i++)
-					{
-						NestedThis->LocalOverlapSubCountMax = FMath::Max(NestedThis->LocalOverlapSubCountMax, NestedThis->OverlapSubCount[i]);
-						NestedThis->LocalOverlapCountMax = FMath::Max(NestedThis->LocalOverlapCountMax, NestedThis->OverlapCount[i]);
-					}
-				};
-
-				if (This->ManagedOverlaps.IsEmpty())
-				{
-					WrapUp();
-					return;
+					This->LocalOverlapSubCountMax = FMath::Max(This->LocalOverlapSubCountMax, This->OverlapSubCount[i]);
+					This->LocalOverlapCountMax = FMath::Max(This->LocalOverlapCountMax, This->OverlapCount[i]);
 				}
-
-				PCGEX_ASYNC_GROUP_CHKD_VOID(This->AsyncManager, SearchTask)
-				SearchTask->OnCompleteCallback = WrapUp;
-				SearchTask->OnSubLoopStartCallback = [AsyncThis](const PCGExMT::FScope& Scope)
-				{
-					PCGEX_ASYNC_NESTED_THIS
-					for (int i = Scope.Start; i < Scope.End; i++) { NestedThis->ResolveOverlap(i); }
-				};
-				SearchTask->StartSubLoops(This->Overlaps.Num(), 8);
 			};
 
-		PreparationTask->OnSubLoopStartCallback =
+		SearchTask->OnSubLoopStartCallback =
 			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
 			{
 				PCGEX_ASYNC_THIS
-				const TSharedPtr<PCGExPointsMT::FPointsProcessorBatchBase> Parent = This->ParentBatch.Pin();
-				for (int i = Scope.Start; i < Scope.End; i++)
-				{
-					const TSharedPtr<PCGExData::FFacade> OtherFacade = Parent->ProcessorFacades[i];
-					if (This->PointDataFacade == OtherFacade) { continue; } // Skip self
-
-					const TSharedRef<FProcessor> OtherProcessor = StaticCastSharedRef<FProcessor>(*Parent->SubProcessorMap->Find(&OtherFacade->Source.Get()));
-
-					const FBox Intersection = This->Bounds.Overlap(OtherProcessor->GetBounds());
-					if (!Intersection.IsValid) { continue; } // No overlap
-
-					This->RegisterOverlap(&OtherProcessor.Get(), Intersection);
-				}
+				for (int i = Scope.Start; i < Scope.End; i++) { This->ResolveOverlap(i); }
 			};
-		PreparationTask->StartSubLoops(ParentBatch.Pin()->ProcessorFacades.Num(), 64);
+
+		SearchTask->StartSubLoops(Overlaps.Num(), 8);
 	}
 
 	void FProcessor::Write()
@@ -14,6 +14,7 @@ UPCGExSampleTextureSettings::UPCGExSampleTextureSettings(const FObjectInitialize
 	: Super(ObjectInitializer)
 {
 	UVSource.Update("UVCoords");
+	bSupportStreaming = true;
 }
 
 TArray<FPCGPinProperties> UPCGExSampleTextureSettings::InputPinProperties() const
@@ -101,10 +102,6 @@ namespace PCGExSampleTexture
 
 		if (!FPointsProcessor::Process(InAsyncManager)) { return false; }
 
-		PCGEX_INIT_IO(PointDataFacade->Source, PCGExData::EIOInit::Duplicate)
-
-		SampleState.Init(false, PointDataFacade->GetNum());
-
 		UVGetter = PointDataFacade->GetScopedBroadcaster<FVector2D>(Settings->UVSource);
 
 		if (!UVGetter)
@@ -113,6 +110,11 @@ namespace PCGExSampleTexture
 			return false;
 		}
 
+		// Init once nothing else can fail, a streamed output must not be staged before its points are copied
+		PCGEX_INIT_IO(PointDataFacade->Source, Settings->GetDuplicateInitMode())
+
+		SampleState.Init(false, PointDataFacade->GetNum());
+
 		for (const TObjectPtr<const UPCGExTexParamFactoryData>& Factory : Context->TexParamsFactories)
 		{
 			if (Factory->Config.OutputType == EPCGExTexSampleAttributeType::Invalid) { continue; }
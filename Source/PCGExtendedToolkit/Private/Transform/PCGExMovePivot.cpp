@@ -9,6 +9,12 @@
 #define LOCTEXT_NAMESPACE "PCGExMovePivotElement"
 #define PCGEX_NAMESPACE MovePivot
 
+UPCGExMovePivotSettings::UPCGExMovePivotSettings(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	bSupportStreaming = true;
+}
+
 PCGEX_INITIALIZE_ELEMENT(MovePivot)
 
 bool FPCGExMovePivotElement::Boot(FPCGExContext* InContext) const
@@ -56,18 +62,26 @@ namespace PCGExMovePivot
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExMovePivot::Process);
 
-		if (!FPointsProcessor::Process(InAsyncManager)) { return false; }
+		PointDataFacade->bSupportsScopedGet = Context->bScopedAttributeGet;
 
-		PCGEX_INIT_IO(PointDataFacade->Source, PCGExData::EIOInit::Duplicate)
+		if (!FPointsProcessor::Process(InAsyncManager)) { return false; }
 
 		UVW = Settings->UVW;
 		if (!UVW.Init(ExecutionContext, PointDataFacade)) { return false; }
 
+		// Init once nothing else can fail, a streamed output must not be staged before its points are copied
+		PCGEX_INIT_IO(PointDataFacade->Source, Settings->GetDuplicateInitMode())
+
 		StartParallelLoopForPoints();
 
 		return true;
 	}
 
+	void FProcessor::PrepareSingleLoopScopeForPoints(const PCGExMT::FScope& Scope)
+	{
+		PointDataFacade->Fetch(Scope);
+	}
+
 	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope)
 	{
 		FVector Offset;
@@ -15,12 +15,24 @@ namespace PCGExStaging
 	const FName Tag_CollectionIdx = FName(PCGEx::PCGExPrefix + TEXT("Collection/Idx"));
 	const FName Tag_EntryIdx = FName(PCGEx::PCGExPrefix + TEXT("CollectionEntry"));
 
+	/**
+	 * Group point indices by entry hash.
+	 * Partitions are ordered by first appearance, and indices are sorted inside each partition.
+	 * @param InHashes Entry hash of each point
+	 * @param OutKeys Entry hash of each partition
+	 * @param OutOffsets Start of each partition in OutIndices, plus a trailing end offset
+	 * @param OutIndices Point indices, grouped by partition
+	 */
+	PCGEXTENDEDTOOLKIT_API
+	void BuildPartitions(const TArray<int64>& InHashes, TArray<int64>& OutKeys, TArray<int32>& OutOffsets, TArray<int32>& OutIndices);
+
 	class PCGEXTENDEDTOOLKIT_API FPickPacker : public TSharedFromThis<FPickPacker>
 	{
 		FPCGExContext* Context = nullptr;
 
 		TArray<const UPCGExAssetCollection*> AssetCollections;
-		TMap<const UPCGExAssetCollection*, uint32> CollectionMap;
+		TMap<const UPCGExAssetCollection*, uint32> CollectionMap;     // Filled during setup, read-only afterward
+		TMap<const UPCGExAssetCollection*, uint32> LateCollectionMap; // Collections that were not registered upfront
 		mutable FRWLock AssetCollectionsLock;
 
 		uint16 BaseHash = 0;
@@ -32,21 +44,40 @@ namespace PCGExStaging
 			BaseHash = static_cast<uint16>(InContext->GetInputSettings<UPCGSettings>()->UID);
 		}
 
+		/**
+		 * Register a collection and its sub-collections, recursively.
+		 * Not thread-safe, must be done before any call to GetPickIdx.
+		 */
+		void RegisterCollection(UPCGExAssetCollection* InCollection)
+		{
+			if (!InCollection || CollectionMap.Contains(InCollection)) { return; }
+
+			CollectionMap.Add(InCollection, PCGEx::H32(BaseHash, AssetCollections.Add(InCollection)));
+
+			for (const FPCGExAssetCollectionEntry* Entry : InCollection->LoadCache()->Main->Entries)
+			{
+				if (Entry->bIsSubCollection) { RegisterCollection(Entry->InternalSubCollection); }
+			}
+		}
+
 		uint64 GetPickIdx(const UPCGExAssetCollection* InCollection, const int32 InIndex)
 		{
 			// TODO : Pack index pick + material pick here
 
+			// Registered collections are immutable past setup, no need to lock
+			if (const uint32* ColIdxPtr = CollectionMap.Find(InCollection)) { return PCGEx::H64(*ColIdxPtr, InIndex); }
+
 			{
 				FReadScopeLock ReadScopeLock(AssetCollectionsLock);
-				if (const uint32* ColIdxPtr = CollectionMap.Find(InCollection)) { return PCGEx::H64(*ColIdxPtr, InIndex); }
+				if (const uint32* ColIdxPtr = LateCollectionMap.Find(InCollection)) { return PCGEx::H64(*ColIdxPtr, InIndex); }
 			}
 
 			{
 				FWriteScopeLock WriteScopeLock(AssetCollectionsLock);
-				if (const uint32* ColIdxPtr = CollectionMap.Find(InCollection)) { return PCGEx::H64(*ColIdxPtr, InIndex); }
+				if (const uint32* ColIdxPtr = LateCollectionMap.Find(InCollection)) { return PCGEx::H64(*ColIdxPtr, InIndex); }
 
 				uint32 ColIndex = PCGEx::H32(BaseHash, AssetCollections.Add(InCollection));
-				CollectionMap.Add(InCollection, ColIndex);
+				LateCollectionMap.Add(InCollection, ColIndex);
 				return PCGEx::H64(ColIndex, InIndex);
 			}
 		}
@@ -61,17 +92,23 @@ namespace PCGExStaging
 			FPCGMetadataAttribute<FString>* CollectionPath = InAttributeSet->Metadata->FindOrCreateAttribute<FString>(Tag_CollectionPath, TEXT(""), false, true, true);
 #endif
 
-			for (const TPair<const UPCGExAssetCollection*, uint32>& Pair : CollectionMap)
+			auto PackMap = [&](const TMap<const UPCGExAssetCollection*, uint32>& InMap)
 			{
-				const int64 Key = InAttributeSet->Metadata->AddEntry();
-				CollectionIdx->SetValue(Key, Pair.Value);
+				for (const TPair<const UPCGExAssetCollection*, uint32>& Pair : InMap)
+				{
+					const int64 Key = InAttributeSet->Metadata->AddEntry();
+					CollectionIdx->SetValue(Key, Pair.Value);
 
 #if PCGEX_ENGINE_VERSION > 503
-				CollectionPath->SetValue(Key, FSoftObjectPath(Pair.Key));
+					CollectionPath->SetValue(Key, FSoftObjectPath(Pair.Key));
 #else
-				CollectionPath->SetValue(Key, FSoftObjectPath(Pair.Key).ToString());
+					CollectionPath->SetValue(Key, FSoftObjectPath(Pair.Key).ToString());
 #endif
-			}
+				}
+			};
+
+			PackMap(CollectionMap);
+			PackMap(LateCollectionMap);
 		}
 	};
 
@@ -81,12 +118,22 @@ namespace PCGExStaging
 		TMap<uint32, C*> CollectionMap;
 
 	public:
-		TMap<int64, TSharedPtr<TArray<int32>>> HashedPartitions;
+		TArray<int64> PartitionKeys;    // Entry hash of each partition
+		TArray<int32> PartitionOffsets; // Start of each partition in PartitionIndices, plus a trailing end offset
+		TArray<int32> PartitionIndices; // Point indices, grouped by partition
 
 		TPickUnpacker()
 		{
 		}
 
+		int32 NumPartitions() const { return PartitionKeys.Num(); }
+
+		TArrayView<const int32> GetPartition(const int32 PartitionIndex) const
+		{
+			const int32 Start = PartitionOffsets[PartitionIndex];
+			return MakeArrayView(PartitionIndices.GetData() + Start, PartitionOffsets[PartitionIndex + 1] - Start);
+		}
+
 		bool UnpackDataset(FPCGContext* InContext, const UPCGParamData* InAttributeSet)
 		{
 			const UPCGMetadata* Metadata = InAttributeSet->Metadata;
@@ -206,25 +253,8 @@ namespace PCGExStaging
 			if (const TArrayView<int64> InRange = MakeArrayView(Hashes.GetData(), NumPoints);
 				!InAccessor->GetRange(InRange, 0, *InKeys)) { return false; }
 
-			// Build partitions
-			for (int i = 0; i < NumPoints; i++)
-			{
-				uint64 EntryHash = Hashes[i];
-				TSharedPtr<TArray<int32>>* Indices = HashedPartitions.Find(EntryHash);
-
-				if (!Indices)
-				{
-					PCGEX_MAKE_SHARED(NewIndices, TArray<int32>)
-					NewIndices->Add(i);
-					HashedPartitions.Add(EntryHash, NewIndices);
-				}
-				else
-				{
-					(*Indices)->Add(i);
-				}
-			}
-
-			return !HashedPartitions.IsEmpty();
+			PCGExStaging::BuildPartitions(Hashes, PartitionKeys, PartitionOffsets, PartitionIndices);
+			return !PartitionKeys.IsEmpty();
 		}
 	};
 }
@@ -49,6 +49,7 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExActorCollectionEntry : public FPCGExAssetCol
 	virtual void GetAssetPaths(TSet<FSoftObjectPath>& OutPaths) const override;
 
 	virtual bool Validate(const UPCGExAssetCollection* ParentCollection) override;
+	virtual uint32 GetCacheHash() const override;
 	virtual void UpdateStaging(const UPCGExAssetCollection* OwningCollection, int32 InInternalIndex, const bool bRecursive) override;
 	virtual void SetAssetPath(const FSoftObjectPath& InPath) override;
 
@@ -9,6 +9,7 @@
 #include "Data/PCGExAttributeHelpers.h"
 #include "Data/PCGExData.h"
 #include "Engine/DataAsset.h"
+#include "UObject/ObjectSaveContext.h"
 #include "PCGExFitting.h"
 
 #include "PCGExAssetCollection.generated.h"
@@ -44,6 +45,7 @@ bool GetEntryWeightedRandom(const _ENTRY_TYPE*& OutEntry, const int32 Seed, uint
 #define PCGEX_ASSET_COLLECTION_BOILERPLATE_BASE(_TYPE, _ENTRY_TYPE)\
 virtual bool IsValidIndex(const int32 InIndex) const { return Entries.IsValidIndex(InIndex); }\
 virtual int32 NumEntries() const override {return Entries.Num(); }\
+virtual uint32 GetEntriesHash() const override {return GetEntriesHashTpl(Entries); }\
 PCGEX_ASSET_COLLECTION_GET_ENTRY_TYPED(_TYPE, _ENTRY_TYPE)\
 PCGEX_ASSET_COLLECTION_GET_ENTRY(_TYPE, _ENTRY_TYPE)\
 virtual bool BuildFromAttributeSet(FPCGExContext* InContext, const UPCGParamData* InAttributeSet, const FPCGExAssetAttributeSetDetails& Details, const bool bBuildStaging) override \
@@ -321,12 +323,62 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExAssetCollectionEntry
 #endif
 
 	virtual bool Validate(const UPCGExAssetCollection* ParentCollection);
+
+	/** Hash of the fields the compiled cache depends on (weight, category, validity & sub-collection), stable across sessions. */
+	virtual uint32 GetCacheHash() const;
+
 	virtual void UpdateStaging(const UPCGExAssetCollection* OwningCollection, int32 InInternalIndex, const bool bRecursive);
 	virtual void SetAssetPath(const FSoftObjectPath& InPath);
 
 	virtual void GetAssetPaths(TSet<FSoftObjectPath>& OutPaths) const;
 };
 
+USTRUCT()
+struct PCGEXTENDEDTOOLKIT_API FPCGExAssetCollectionBakedCategory
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FName Name = NAME_None;
+
+	UPROPERTY()
+	double WeightSum = 0;
+
+	UPROPERTY()
+	TArray<int32> Indices;
+
+	UPROPERTY()
+	TArray<int32> Weights;
+
+	UPROPERTY()
+	TArray<int32> Order;
+};
+
+/** Compiled cache data, baked when the collection is saved so it doesn't have to be rebuilt at runtime. */
+USTRUCT()
+struct PCGEXTENDEDTOOLKIT_API FPCGExAssetCollectionBakedCache
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	bool bValid = false;
+
+	/** Hash of the entries the cache was baked against, see UPCGExAssetCollection::GetEntriesHash. */
+	UPROPERTY()
+	uint32 EntriesHash = 0;
+
+	UPROPERTY()
+	int32 WeightSum = 0;
+
+	UPROPERTY()
+	FPCGExAssetCollectionBakedCategory Main;
+
+	UPROPERTY()
+	TArray<FPCGExAssetCollectionBakedCategory> Categories;
+
+	bool IsValid(const uint32 InEntriesHash) const { return bValid && EntriesHash == InEntriesHash; }
+};
+
 namespace PCGExAssetCollection
 {
 	class PCGEXTENDEDTOOLKIT_API FCategory : public TSharedFromThis<FCategory>
@@ -364,6 +416,9 @@ namespace PCGExAssetCollection
 
 		void RegisterEntry(const int32 Index, const FPCGExAssetCollectionEntry* InEntry);
 		void Compile();
+
+		void Bake(FPCGExAssetCollectionBakedCategory& OutBaked) const;
+		void Restore(const FPCGExAssetCollectionBakedCategory& InBaked, TFunctionRef<const FPCGExAssetCollectionEntry*(const int32)> GetEntry);
 	};
 
 	struct PCGEXTENDEDTOOLKIT_API FCache
@@ -384,6 +439,9 @@ namespace PCGExAssetCollection
 		void Compile();
 
 		void RegisterEntry(const int32 Index, const FPCGExAssetCollectionEntry* InEntry);
+
+		void Bake(FPCGExAssetCollectionBakedCache& OutBaked, const uint32 InEntriesHash) const;
+		void Restore(const FPCGExAssetCollectionBakedCache& InBaked, TFunctionRef<const FPCGExAssetCollectionEntry*(const int32)> GetEntry);
 	};
 
 #pragma region Staging bounds update
@@ -414,6 +472,7 @@ public:
 	virtual void PostLoad() override;
 	virtual void PostDuplicate(bool bDuplicateForPIE) override;
 	virtual void PostEditImport() override;
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
 
 	virtual void RebuildStagingData(const bool bRecursive);
 
@@ -537,6 +596,9 @@ public:
 	virtual bool IsValidIndex(const int32 InIndex) const { return false; }
 	virtual int32 NumEntries() const { return 0; }
 
+	/** Hash of all entries' cache-relevant fields, used to detect a stale baked cache. */
+	virtual uint32 GetEntriesHash() const { return 0; }
+
 	virtual bool GetEntryAt(const FPCGExAssetCollectionEntry*& OutEntry, const int32 Index, const UPCGExAssetCollection*& OutHost)
 	PCGEX_NOT_IMPLEMENTED_RET(GetEntryAt, false)
 
@@ -752,8 +814,19 @@ protected:
 	UPROPERTY()
 	bool bCacheNeedsRebuild = true;
 
+	UPROPERTY()
+	FPCGExAssetCollectionBakedCache BakedCache;
+
 	TUniquePtr<PCGExAssetCollection::FCache> Cache;
 
+	template <typename T>
+	uint32 GetEntriesHashTpl(const TArray<T>& InEntries) const
+	{
+		uint32 Hash = HashCombine(GetTypeHash(InEntries.Num()), GetTypeHash(bDoNotIgnoreInvalidEntries));
+		for (const T& Entry : InEntries) { Hash = HashCombine(Hash, Entry.GetCacheHash()); }
+		return Hash;
+	}
+
 	template <typename T>
 	bool BuildCache(TArray<T>& InEntries)
 	{
@@ -766,6 +839,17 @@ protected:
 		bCacheNeedsRebuild = false;
 
 		const int32 NumEntries = InEntries.Num();
+
+		if (BakedCache.IsValid(GetEntriesHashTpl(InEntries)))
+		{
+			// Baked at save time, only entry pointers need resolving
+			Cache->Restore(BakedCache, [&](const int32 Index) { return static_cast<const FPCGExAssetCollectionEntry*>(&InEntries[Index]); });
+
+			// Sub-collections restore their own baked cache
+			for (T& Entry : InEntries) { if (Entry.bIsSubCollection && Entry.InternalSubCollection) { Entry.InternalSubCollection->LoadCache(); } }
+
+			return true;
+		}
 		Cache->Main->Reserve(NumEntries);
 
 		TArray<PCGExAssetCollection::FCategory*> TempCategories;
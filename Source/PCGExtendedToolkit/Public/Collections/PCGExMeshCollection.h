@@ -143,6 +143,7 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExMeshCollectionEntry : public FPCGExAssetColl
 	virtual void GetAssetPaths(TSet<FSoftObjectPath>& OutPaths) const override;
 
 	virtual bool Validate(const UPCGExAssetCollection* ParentCollection) override;
+	virtual uint32 GetCacheHash() const override;
 
 	UPROPERTY()
 	int32 MaterialVariantsCumulativeWeight = -1;
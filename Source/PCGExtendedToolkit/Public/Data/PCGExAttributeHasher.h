@@ -43,6 +43,10 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExAttributeHashConfig
 	/** Whether to sort hash components or not. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="bSortInputValues"))
 	EPCGExSortDirection Sorting = EPCGExSortDirection::Ascending;
+
+	/** Combine all values with a commutative mix instead of sorting them first. Input order still doesn't matter and this scales much better on large data, but resulting hashes differ from the sorted combination. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="bSortInputValues && Scope==EPCGExDataHashScope::All", EditConditionHides))
+	bool bOrderInsensitive = false;
 };
 
 namespace PCGEx
@@ -54,11 +58,7 @@ namespace PCGEx
 		TSharedPtr<TAttributeBroadcaster<PCGExTypeHash>> ValuesGetter;
 
 		TArray<PCGExTypeHash> Values;
-
-		TSet<PCGExTypeHash> UniqueValues;
-		TArray<int32> UniqueIndices;
-
-		uint32 CombinedHashUnique = 0;
+		TArray<uint64> ScopedHashes; // Per-scope partial hashes, order-insensitive mode only
 
 		int32 NumValues = -1;
 		uint32 OutHash = 0;
@@ -77,6 +77,7 @@ namespace PCGEx
 		int32 GetHash() const { return OutHash; }
 
 	protected:
+		bool IsOrderInsensitive() const;
 		void CompileScope(const PCGExMT::FScope& Scope);
 		void OnCompilationComplete();
 	};
@@ -395,7 +395,9 @@ namespace PCGExData
 
 			auto GrabExistingValues = [&]()
 			{
-				TUniquePtr<FPCGAttributeAccessorKeysPoints> TempOutKeys = MakeUnique<FPCGAttributeAccessorKeysPoints>(MakeArrayView(Source->GetMutablePoints().GetData(), OutValues->Num()));
+				// Streamed outputs are not populated yet, but share their entry keys with the input points
+				FPCGPoint* KeyPoints = Source->IsStreaming() ? const_cast<FPCGPoint*>(Source->GetIn()->GetPoints().GetData()) : Source->GetMutablePoints().GetData();
+				TUniquePtr<FPCGAttributeAccessorKeysPoints> TempOutKeys = MakeUnique<FPCGAttributeAccessorKeysPoints>(MakeArrayView(KeyPoints, OutValues->Num()));
 				TArrayView<T> OutRange = MakeArrayView(OutValues->GetData(), OutValues->Num());
 				OutAccessor->GetRange(OutRange, 0, *TempOutKeys.Get());
 			};
@@ -24,7 +24,8 @@ namespace PCGExData
 		None UMETA(DisplayName = "No Output"),
 		New UMETA(DisplayName = "Create Empty Output Object"),
 		Duplicate UMETA(DisplayName = "Duplicate Input Object"),
-		Forward UMETA(DisplayName = "Forward Input Object")
+		Forward UMETA(DisplayName = "Forward Input Object"),
+		Stream UMETA(DisplayName = "Stream Input Object")
 	};
 
 	enum class ESource : uint8
@@ -73,6 +74,7 @@ namespace PCGExData
 	protected:
 		bool bTransactional = false;
 		bool bMutable = false;
+		bool bStreaming = false;
 		FPCGExContext* Context = nullptr;
 		TWeakPtr<PCGEx::FWorkPermit> WorkPermit;
 
@@ -135,9 +137,25 @@ namespace PCGExData
 		bool InitializeOutput(const EIOInit InitOut = EIOInit::None)
 		{
 			if (!WorkPermit.IsValid()) { return false; }
-			if (IsValid(Out) && Out != In) { Context->ManagedObjects->Destroy(Out); }
+			if (IsValid(Out) && Out != In)
+			{
+				Context->ManagedObjects->Destroy(Out);
+				Out = nullptr;
+			}
 
 			bMutable = true;
+			bStreaming = false;
+
+			if (InitOut == EIOInit::Stream)
+			{
+				// See untyped InitializeOutput
+				check(In)
+				if (!InitializeOutput<T>(EIOInit::New)) { return false; }
+
+				Out->GetMutablePoints().SetNumZeroed(In->GetPoints().Num());
+				bStreaming = true;
+				return true;
+			}
 
 			if (InitOut == EIOInit::New)
 			{
@@ -181,6 +199,15 @@ namespace PCGExData
 
 		~FPointIO();
 
+		/**
+		 * Whether the output was initialized with EIOInit::Stream.
+		 * Streamed outputs share the input metadata and only hold valid points once their scope has been streamed.
+		 */
+		bool IsStreaming() const { return bStreaming; }
+
+		/** Copy a range of input points into a streamed output. Ranges must not overlap, safe to call from parallel scopes. */
+		void StreamRange(const int32 Start, const int32 Count) const;
+
 		bool IsDataValid(const ESource InSource) const { return InSource == ESource::In ? IsValid(In) : IsValid(Out); }
 
 		const UPCGPointData* GetData(const ESource InSource) const { return InSource == ESource::In ? In : Out; }
@@ -267,6 +267,48 @@ namespace PCGExGeo
 		 */
 		FVector GetLocationOnArc(const double Alpha) const;
 	};
+
+	/**
+	 * Sweep-and-prune broadphase over a set of boxes.
+	 * Invalid boxes are ignored.
+	 * @param InBoxes 
+	 * @param OutPairs Overlapping pairs as PCGEx::H64(Lower, Higher), sorted
+	 */
+	PCGEXTENDEDTOOLKIT_API
+	void FindOverlappingPairs(const TArray<FBox>& InBoxes, TArray<uint64>& OutPairs);
+
+	/**
+	 * Single broadphase over all processors bounds; each overlapping pair is registered once from here so processors don't need to lock.
+	 * The lower index processor manages the overlap.
+	 * @tparam TOverlap Overlap type, constructed from (Manager*, Managed*, Intersection)
+	 * @param InProcessors Processors exposing bIsProcessorValid, GetBounds(), Overlaps & ManagedOverlaps
+	 */
+	template <typename TOverlap, typename TProcessor>
+	void RegisterOverlaps(const TArray<TSharedRef<TProcessor>>& InProcessors)
+	{
+		TArray<FBox> Bounds;
+		Bounds.Init(FBox(ForceInit), InProcessors.Num());
+		for (int i = 0; i < InProcessors.Num(); i++) { if (InProcessors[i]->bIsProcessorValid) { Bounds[i] = InProcessors[i]->GetBounds(); } }
+
+		TArray<uint64> Pairs;
+		FindOverlappingPairs(Bounds, Pairs);
+
+		for (const uint64 Pair : Pairs)
+		{
+			uint32 A;
+			uint32 B;
+			PCGEx::H64(Pair, A, B);
+
+			TProcessor* Manager = &InProcessors[A].Get();
+			TProcessor* Managed = &InProcessors[B].Get();
+
+			const TSharedRef<TOverlap> NewOverlap = MakeShared<TOverlap>(Manager, Managed, Bounds[A].Overlap(Bounds[B]));
+
+			Manager->Overlaps.Add(NewOverlap);
+			Manager->ManagedOverlaps.Add(NewOverlap);
+			Managed->Overlaps.Add(NewOverlap);
+		}
+	}
 }
 
 namespace PCGExGeoTasks
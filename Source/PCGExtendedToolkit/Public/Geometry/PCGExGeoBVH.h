@@ -0,0 +1,195 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExMacros.h"
+
+namespace PCGExGeo
+{
+	/**
+	 * Static bounding volume hierarchy over a set of boxes.
+	 * Built once with median splits along the widest centroid axis, then read-only and safe to query from multiple threads.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FBoxBVH : public TSharedFromThis<FBoxBVH>
+	{
+	public:
+		struct FNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Start = 0; // First child node, or first item for leaves
+			int32 Count = 0; // Item count for leaves, 0 for inner nodes
+			FORCEINLINE bool IsLeaf() const { return Count > 0; }
+		};
+
+	protected:
+		TArray<FNode> Nodes;
+		TArray<int32> Items;
+		TArray<FBox> Boxes;
+
+		void BuildNode(const int32 NodeIndex, const int32 Start, const int32 Count, const int32 LeafSize, const TArray<FVector>& Centers);
+
+	public:
+		FBoxBVH() = default;
+
+		void Build(const TArray<FBox>& InBoxes, const int32 LeafSize = 4);
+
+		FORCEINLINE bool IsEmpty() const { return Nodes.IsEmpty(); }
+		FORCEINLINE const FBox& GetBox(const int32 Index) const { return Boxes[Index]; }
+		FORCEINLINE const FBox& GetBounds() const { return Nodes[0].Bounds; }
+
+		/** Calls Func(ItemIndex) for every box overlapping the query */
+		template <typename FuncT>
+		void FindIntersecting(const FBox& Query, FuncT&& Func) const
+		{
+			if (Nodes.IsEmpty()) { return; }
+
+			TArray<int32, TInlineAllocator<64>> Stack;
+			Stack.Add(0);
+
+			while (!Stack.IsEmpty())
+			{
+#if PCGEX_ENGINE_VERSION <= 503
+				const FNode& Node = Nodes[Stack.Pop(false)];
+#else
+				const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+#endif
+				if (!Node.Bounds.Intersect(Query)) { continue; }
+
+				if (!Node.IsLeaf())
+				{
+					Stack.Add(Node.Start);
+					Stack.Add(Node.Start + 1);
+					continue;
+				}
+
+				for (int i = Node.Start; i < Node.Start + Node.Count; i++)
+				{
+					const int32 Item = Items[i];
+					if (Boxes[Item].Intersect(Query)) { Func(Item); }
+				}
+			}
+		}
+
+		/** Slab test of the [Origin, Origin + Dir] segment against a box. InvDir components are ignored where Dir is zero. */
+		static FORCEINLINE bool SegmentIntersect(const FBox& Box, const FVector& Origin, const FVector& Dir, const FVector& InvDir)
+		{
+			double TMin = 0;
+			double TMax = 1;
+
+			for (int a = 0; a < 3; a++)
+			{
+				if (Dir[a] == 0)
+				{
+					// Parallel to the slab, origin must be within
+					if (Origin[a] < Box.Min[a] || Origin[a] > Box.Max[a]) { return false; }
+					continue;
+				}
+
+				double T1 = (Box.Min[a] - Origin[a]) * InvDir[a];
+				double T2 = (Box.Max[a] - Origin[a]) * InvDir[a];
+				if (T1 > T2) { Swap(T1, T2); }
+
+				TMin = FMath::Max(TMin, T1);
+				TMax = FMath::Min(TMax, T2);
+				if (TMin > TMax) { return false; }
+			}
+
+			return true;
+		}
+
+		/** Calls Func(ItemIndex) for every box crossed by the segment */
+		template <typename FuncT>
+		void FindSegmentIntersecting(const FVector& Start, const FVector& End, FuncT&& Func) const
+		{
+			if (Nodes.IsEmpty()) { return; }
+
+			const FVector Dir = End - Start;
+			const FVector InvDir = FVector(
+				Dir.X != 0 ? 1 / Dir.X : 0,
+				Dir.Y != 0 ? 1 / Dir.Y : 0,
+				Dir.Z != 0 ? 1 / Dir.Z : 0);
+
+			TArray<int32, TInlineAllocator<64>> Stack;
+			Stack.Add(0);
+
+			while (!Stack.IsEmpty())
+			{
+#if PCGEX_ENGINE_VERSION <= 503
+				const FNode& Node = Nodes[Stack.Pop(false)];
+#else
+				const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+#endif
+				if (!SegmentIntersect(Node.Bounds, Start, Dir, InvDir)) { continue; }
+
+				if (!Node.IsLeaf())
+				{
+					Stack.Add(Node.Start);
+					Stack.Add(Node.Start + 1);
+					continue;
+				}
+
+				for (int i = Node.Start; i < Node.Start + Node.Count; i++)
+				{
+					const int32 Item = Items[i];
+					if (SegmentIntersect(Boxes[Item], Start, Dir, InvDir)) { Func(Item); }
+				}
+			}
+		}
+
+		/**
+		 * Best-first traversal ordered by squared distance from Position to each box.
+		 * Func(ItemIndex, BoxDistSquared) is expected to return the current best squared distance;
+		 * nodes and items farther than that are pruned. Boxes at exactly the best distance are still visited so callers can break ties.
+		 */
+		template <typename FuncT>
+		void FindClosest(const FVector& Position, FuncT&& Func, const double MaxDistSquared = MAX_dbl) const
+		{
+			if (Nodes.IsEmpty()) { return; }
+
+			struct FCandidate
+			{
+				double DistSquared;
+				int32 Node;
+				bool operator<(const FCandidate& Other) const { return DistSquared < Other.DistSquared; }
+			};
+
+			double Best = MaxDistSquared;
+
+			TArray<FCandidate, TInlineAllocator<64>> Heap;
+			Heap.HeapPush(FCandidate{Nodes[0].Bounds.ComputeSquaredDistanceToPoint(Position), 0});
+
+			while (!Heap.IsEmpty())
+			{
+				FCandidate Candidate;
+#if PCGEX_ENGINE_VERSION <= 503
+				Heap.HeapPop(Candidate, false);
+#else
+				Heap.HeapPop(Candidate, EAllowShrinking::No);
+#endif
+
+				if (Candidate.DistSquared > Best) { break; } // Everything left is farther
+
+				const FNode& Node = Nodes[Candidate.Node];
+
+				if (!Node.IsLeaf())
+				{
+					for (int c = 0; c < 2; c++)
+					{
+						const double Dist = Nodes[Node.Start + c].Bounds.ComputeSquaredDistanceToPoint(Position);
+						if (Dist <= Best) { Heap.HeapPush(FCandidate{Dist, Node.Start + c}); }
+					}
+					continue;
+				}
+
+				for (int i = Node.Start; i < Node.Start + Node.Count; i++)
+				{
+					const int32 Item = Items[i];
+					const double Dist = Boxes[Item].ComputeSquaredDistanceToPoint(Position);
+					if (Dist <= Best) { Best = FMath::Min(Best, Func(Item, Dist)); }
+				}
+			}
+		}
+	};
+}
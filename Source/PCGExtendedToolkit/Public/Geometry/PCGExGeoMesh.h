@@ -8,6 +8,9 @@
 #include "PCGExH.h"
 #include "PCGExMT.h"
 #include "PCGExHelpers.h"
+#include "Algo/Unique.h"
+#include "Engine/StaticMesh.h"
+#include "StaticMeshResources.h"
 
 
 //#include "PCGExGeoMesh.generated.h"
@@ -22,31 +25,18 @@ enum class EPCGExTriangulationType : uint8
 
 namespace PCGExGeo
 {
-	class PCGEXTENDEDTOOLKIT_API FMeshLookup : public TSharedFromThis<FMeshLookup>
-	{
-	protected:
-		uint32 InternalIdx = 0;
-
-	public:
-		TMap<uint32, TTuple<int32, uint32>> Data;
-
-		explicit FMeshLookup(const int32 Size)
-		{
-			Data.Reserve(Size);
-		}
-
-		FORCEINLINE uint32 Add_GetIdx(const uint32 Key, const int32 Value)
-		{
-			if (TTuple<int32, uint32>* Tuple = Data.Find(Key)) { return Tuple->Get<1>(); }
-			const int32 SnapIdx = InternalIdx;
-			Data.Add(Key, TTuple<int32, uint32>(Value, InternalIdx++));
-			return SnapIdx;
-		}
+	class FExtractStaticMeshTask;
 
-		FORCEINLINE int32 Num() const { return Data.Num(); }
+	/** Flat topology extracted from a static mesh, shared across executions */
+	struct PCGEXTENDEDTOOLKIT_API FMeshTopology
+	{
+		TArray<FVector> Vertices;
+		TArray<uint64> Edges;
 	};
 
-	class FExtractStaticMeshTask;
+	TSharedPtr<const FMeshTopology> FindCachedMeshTopology(const UStaticMesh* InStaticMesh, const int32 InLODIndex, const EPCGExTriangulationType InType);
+	void CacheMeshTopology(const UStaticMesh* InStaticMesh, const int32 InLODIndex, const EPCGExTriangulationType InType, const TSharedPtr<const FMeshTopology>& InTopology);
+	void FlushMeshTopologyCache();
 
 	class PCGEXTENDEDTOOLKIT_API FGeoMesh : public TSharedFromThis<FGeoMesh>
 	{
@@ -54,7 +44,7 @@ namespace PCGExGeo
 		bool bIsValid = false;
 		bool bIsLoaded = false;
 		TArray<FVector> Vertices;
-		TSet<uint64> Edges;
+		TArray<uint64> Edges; // Sorted, unique
 		TArray<FIntVector3> Triangles;
 		TArray<FIntVector3> Adjacencies;
 
@@ -88,6 +78,9 @@ namespace PCGExGeo
 			Vertices.Append(DualPositions);
 			DualPositions.Empty();
 
+			Edges.Sort();
+			Edges.SetNum(Algo::Unique(Edges));
+
 			Triangles.Empty();
 			Adjacencies.Empty();
 		}
@@ -114,6 +107,9 @@ namespace PCGExGeo
 				Edges.Add(PCGEx::H64U(E, Triangle.Z));
 			}
 
+			Edges.Sort();
+			Edges.SetNum(Algo::Unique(Edges));
+
 			Triangles.Empty();
 			Adjacencies.Empty();
 		}
@@ -125,149 +121,44 @@ namespace PCGExGeo
 	{
 	public:
 		TObjectPtr<UStaticMesh> StaticMesh;
+		int32 LODIndex = 0;
 		FVector CWTolerance = FVector(1 / 0.001);
 
-		explicit FGeoStaticMesh(const TSoftObjectPtr<UStaticMesh>& InSoftStaticMesh)
+		/** Set by ExtractTopologySynchronous; shared with the topology cache, Vertices & Edges are left empty */
+		TSharedPtr<const FMeshTopology> Topology;
+
+		explicit FGeoStaticMesh(const TSoftObjectPtr<UStaticMesh>& InSoftStaticMesh, const int32 InLODIndex = 0)
 		{
 			if (!InSoftStaticMesh.ToSoftObjectPath().IsValid()) { return; }
 
 			StaticMesh = PCGExHelpers::LoadBlocking_AnyThread(InSoftStaticMesh);
 			if (!StaticMesh) { return; }
 
-			StaticMesh->GetRenderData();
-			bIsValid = true;
-		}
+			const FStaticMeshRenderData* RenderData = StaticMesh->GetRenderData();
+			if (!RenderData || RenderData->LODResources.IsEmpty()) { return; }
 
-		explicit FGeoStaticMesh(const FSoftObjectPath& InSoftStaticMesh):
-			FGeoStaticMesh(TSoftObjectPtr<UStaticMesh>(InSoftStaticMesh))
-		{
+			LODIndex = FMath::Clamp(InLODIndex, 0, RenderData->LODResources.Num() - 1);
+			bIsValid = true;
 		}
 
-		explicit FGeoStaticMesh(const FString& InSoftStaticMesh):
-			FGeoStaticMesh(TSoftObjectPtr<UStaticMesh>(FSoftObjectPath(InSoftStaticMesh)))
+		explicit FGeoStaticMesh(const FSoftObjectPath& InSoftStaticMesh, const int32 InLODIndex = 0):
+			FGeoStaticMesh(TSoftObjectPtr<UStaticMesh>(InSoftStaticMesh), InLODIndex)
 		{
 		}
 
-		void ExtractMeshSynchronous()
+		explicit FGeoStaticMesh(const FString& InSoftStaticMesh, const int32 InLODIndex = 0):
+			FGeoStaticMesh(TSoftObjectPtr<UStaticMesh>(FSoftObjectPath(InSoftStaticMesh)), InLODIndex)
 		{
-			if (bIsLoaded) { return; }
-			if (!bIsValid) { return; }
-
-			const FStaticMeshLODResources& LODResources = StaticMesh->GetRenderData()->LODResources[0];
-
-			const FPositionVertexBuffer& VertexBuffer = LODResources.VertexBuffers.PositionVertexBuffer;
-
-			TUniquePtr<FMeshLookup> MeshLookup = MakeUnique<FMeshLookup>(VertexBuffer.GetNumVertices() / 3);
-			Edges.Empty();
-
-			const FIndexArrayView& Indices = LODResources.IndexBuffer.GetArrayView();
-			for (int i = 0; i < Indices.Num(); i += 3)
-			{
-				const int32 AIdx = Indices[i];
-				const int32 BIdx = Indices[i + 1];
-				const int32 CIdx = Indices[i + 2];
-
-				const uint32 A = MeshLookup->Add_GetIdx(PCGEx::GH3(VertexBuffer.VertexPosition(AIdx), CWTolerance), AIdx);
-				const uint32 B = MeshLookup->Add_GetIdx(PCGEx::GH3(VertexBuffer.VertexPosition(BIdx), CWTolerance), BIdx);
-				const uint32 C = MeshLookup->Add_GetIdx(PCGEx::GH3(VertexBuffer.VertexPosition(CIdx), CWTolerance), CIdx);
-
-				Edges.Add(PCGEx::H64U(A, B));
-				Edges.Add(PCGEx::H64U(B, C));
-				Edges.Add(PCGEx::H64U(C, A));
-			}
-
-			PCGEx::InitArray(Vertices, MeshLookup->Num());
-			for (const TPair<uint32, TTuple<int32, uint32>>& Pair : MeshLookup->Data) { Vertices[Pair.Value.Get<1>()] = FVector(VertexBuffer.VertexPosition(Pair.Value.Get<0>())); }
-
-			bIsLoaded = true;
 		}
 
-		void TriangulateMeshSynchronous()
-		{
-			if (bIsLoaded) { return; }
-			if (!bIsValid) { return; }
-
-			Edges.Empty();
-
-			const FStaticMeshLODResources& LODResources = StaticMesh->GetRenderData()->LODResources[0];
-
-			const FPositionVertexBuffer& VertexBuffer = LODResources.VertexBuffers.PositionVertexBuffer;
-
-			TUniquePtr<FMeshLookup> MeshLookup = MakeUnique<FMeshLookup>(VertexBuffer.GetNumVertices() / 3);
-			TMap<uint64, uint64> EdgeAdjacency;
-
-			const FIndexArrayView& Indices = LODResources.IndexBuffer.GetArrayView();
-
-			PCGEx::InitArray(Triangles, Indices.Num() / 3);
-			int32 TriangleIndex = 0;
-
-			for (int i = 0; i < Indices.Num(); i += 3)
-			{
-				const int32 AIdx = Indices[i];
-				const int32 BIdx = Indices[i + 1];
-				const int32 CIdx = Indices[i + 2];
-
-				const uint32 A = MeshLookup->Add_GetIdx(PCGEx::GH3(VertexBuffer.VertexPosition(AIdx), CWTolerance), AIdx);
-				const uint32 B = MeshLookup->Add_GetIdx(PCGEx::GH3(VertexBuffer.VertexPosition(BIdx), CWTolerance), BIdx);
-				const uint32 C = MeshLookup->Add_GetIdx(PCGEx::GH3(VertexBuffer.VertexPosition(CIdx), CWTolerance), CIdx);
-
-				Edges.Add(PCGEx::H64U(A, B));
-				Edges.Add(PCGEx::H64U(B, C));
-				Edges.Add(PCGEx::H64U(C, A));
-
-				const uint64 AB = PCGEx::H64U(A, B);
-				const uint64 BC = PCGEx::H64U(B, C);
-				const uint64 AC = PCGEx::H64U(A, C);
-
-				Edges.Add(AB);
-				Edges.Add(BC);
-				Edges.Add(AC);
-
-				// Triangles and adjacency
-
-				// Each edge can store its adjacency as a uint64 : left triangle index, right triangle index
+		/** Raw triangle edges, with vertices welded by position */
+		void ExtractMeshSynchronous();
 
-				const uint64* AdjacencyABPtr = EdgeAdjacency.Find(AB);
-				const uint64* AdjacencyBCPtr = EdgeAdjacency.Find(BC);
-				const uint64* AdjacencyACPtr = EdgeAdjacency.Find(AC);
+		/** Welded triangles and per-edge triangle adjacency, required by MakeDual & MakeHollowDual */
+		void TriangulateMeshSynchronous();
 
-				Triangles[TriangleIndex] = FIntVector3(A, B, C);
-
-				if (AdjacencyABPtr) { EdgeAdjacency.Add(AB, PCGEx::NH64(TriangleIndex, PCGEx::NH64B(*AdjacencyABPtr))); }
-				else { EdgeAdjacency.Add(AB, PCGEx::NH64(-1, TriangleIndex)); }
-
-				if (AdjacencyBCPtr) { EdgeAdjacency.Add(BC, PCGEx::NH64(TriangleIndex, PCGEx::NH64B(*AdjacencyBCPtr))); }
-				else { EdgeAdjacency.Add(BC, PCGEx::NH64(-1, TriangleIndex)); }
-
-				if (AdjacencyACPtr) { EdgeAdjacency.Add(AC, PCGEx::NH64(TriangleIndex, PCGEx::NH64B(*AdjacencyACPtr))); }
-				else { EdgeAdjacency.Add(AC, PCGEx::NH64(-1, TriangleIndex)); }
-
-				TriangleIndex++;
-			}
-
-			PCGEx::InitArray(Adjacencies, Triangles.Num());
-
-			for (int j = 0; j < Triangles.Num(); j++)
-			{
-				FIntVector3 Triangle = Triangles[j];
-
-				uint64* AdjacencyABPtr = EdgeAdjacency.Find(PCGEx::H64U(Triangle.X, Triangle.Y));
-				uint64* AdjacencyBCPtr = EdgeAdjacency.Find(PCGEx::H64U(Triangle.Y, Triangle.Z));
-				uint64* AdjacencyACPtr = EdgeAdjacency.Find(PCGEx::H64U(Triangle.X, Triangle.Z));
-
-				Adjacencies[j] = FIntVector3(
-					AdjacencyABPtr ? PCGEx::NH64NOT(*AdjacencyABPtr, j) : -1,
-					AdjacencyBCPtr ? PCGEx::NH64NOT(*AdjacencyBCPtr, j) : -1,
-					AdjacencyACPtr ? PCGEx::NH64NOT(*AdjacencyACPtr, j) : -1);
-			}
-
-			EdgeAdjacency.Empty();
-
-			PCGEx::InitArray(Vertices, MeshLookup->Num());
-			for (const TPair<uint32, TTuple<int32, uint32>>& Pair : MeshLookup->Data) { Vertices[Pair.Value.Get<1>()] = FVector(VertexBuffer.VertexPosition(Pair.Value.Get<0>())); }
-
-			bIsLoaded = true;
-		}
+		/** Extract topology for the desired triangulation type, reusing a previous extraction of the same mesh, LOD & type if any */
+		void ExtractTopologySynchronous();
 
 		void ExtractMeshAsync(PCGExMT::FTaskManager* AsyncManager);
 
@@ -283,6 +174,7 @@ namespace PCGExGeo
 		TArray<TSharedPtr<FGeoStaticMesh>> GSMs;
 
 		EPCGExTriangulationType DesiredTriangulationType = EPCGExTriangulationType::Raw;
+		int32 LODIndex = 0;
 
 		FGeoStaticMeshMap()
 		{
@@ -292,7 +184,7 @@ namespace PCGExGeo
 		{
 			if (const int32* GSMPtr = Map.Find(InPath)) { return *GSMPtr; }
 
-			PCGEX_MAKE_SHARED(GSM, FGeoStaticMesh, InPath)
+			PCGEX_MAKE_SHARED(GSM, FGeoStaticMesh, InPath, LODIndex)
 			if (!GSM->bIsValid) { return -1; }
 
 			const int32 Index = GSMs.Add(GSM);
@@ -322,7 +214,7 @@ namespace PCGExGeo
 
 		virtual void ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager) override
 		{
-			GSM->ExtractMeshSynchronous();
+			GSM->ExtractTopologySynchronous();
 		}
 	};
 
@@ -9,6 +9,7 @@
 #include "Data/Blending/PCGExBlendModes.h"
 #include "PCGExHelpers.h"
 #include "Data/PCGPointData.h"
+#include "Geometry/PCGExGeoBVH.h"
 
 #include "PCGExGeoPointBox.generated.h"
 
@@ -79,7 +80,7 @@ namespace PCGExGeo
 			Cuts.Sort(
 				[&](const FCut& A, const FCut& B)
 				{
-					return FVector::DistSquared(StartPosition, B.Position) < FVector::DistSquared(StartPosition, B.Position);
+					return FVector::DistSquared(StartPosition, A.Position) < FVector::DistSquared(StartPosition, B.Position);
 				});
 		}
 
@@ -117,65 +118,6 @@ namespace PCGExGeo
 		}
 	};
 
-	class PCGEXTENDEDTOOLKIT_API FSegmentation
-	{
-		mutable FRWLock IntersectionsLock;
-
-	public:
-		TMap<uint64, TSharedPtr<FIntersections>> IntersectionsMap;
-		TArray<TSharedPtr<FIntersections>> IntersectionsList;
-
-		FSegmentation()
-		{
-		}
-
-		~FSegmentation() = default;
-
-		int32 GetNum() const { return IntersectionsMap.Num(); }
-
-		int32 GetNumCuts() const
-		{
-			int32 Sum = 0;
-			for (const TPair<uint64, TSharedPtr<FIntersections>>& Pair : IntersectionsMap) { Sum += Pair.Value->Cuts.Num(); }
-			return Sum;
-		}
-
-		void ReduceToArray()
-		{
-			PCGEx::InitArray(IntersectionsList, IntersectionsMap.Num());
-			int32 Index = 0;
-			for (const TPair<uint64, TSharedPtr<FIntersections>>& Pair : IntersectionsMap) { IntersectionsList[Index++] = Pair.Value; }
-			IntersectionsMap.Empty();
-		}
-
-		TSharedPtr<FIntersections> Find(const uint64 Key)
-		{
-			{
-				FReadScopeLock ReadScopeLock(IntersectionsLock);
-				if (TSharedPtr<FIntersections>* ExistingIntersection = IntersectionsMap.Find(Key)) { return *ExistingIntersection; }
-			}
-
-			return nullptr;
-		}
-
-		void Insert(const TSharedPtr<FIntersections>& InIntersections)
-		{
-			FWriteScopeLock WriteScopeLock(IntersectionsLock);
-			IntersectionsMap.Add(InIntersections->GetKey(), InIntersections);
-		}
-
-		TSharedPtr<FIntersections> GetOrCreate(const int32 Start, const int32 End)
-		{
-			const uint64 HID = PCGEx::H64U(Start, End);
-			if (TSharedPtr<FIntersections> ExistingIntersection = Find(HID)) { return ExistingIntersection; }
-
-			PCGEX_MAKE_SHARED(NewIntersections, FIntersections, Start, End)
-			Insert(NewIntersections);
-
-			return NewIntersections;
-		}
-	};
-
 	struct PCGEXTENDEDTOOLKIT_API FPointBox
 	{
 		FMatrix Matrix;
@@ -567,6 +509,9 @@ namespace PCGExGeo
 		TArray<TSharedPtr<FPointBox>> Boxes;
 		FBox CloudBounds;
 
+		mutable FRWLock BVHLock;
+		TSharedPtr<FBoxBVH> BVH;
+
 		FVector SearchPadding;
 
 	public:
@@ -596,8 +541,31 @@ namespace PCGExGeo
 		{
 		}
 
+		/** Builds a BVH over world-space box bounds; once built, segment intersections are found through slab tests instead of octree bounds queries. Thread-safe, built once. */
+		void BuildBVH()
+		{
+			FWriteScopeLock WriteScopeLock(BVHLock);
+			if (BVH) { return; }
+
+			TArray<FBox> WorldBoxes;
+			PCGEx::InitArray(WorldBoxes, Boxes.Num());
+			for (int i = 0; i < Boxes.Num(); i++) { WorldBoxes[i] = Boxes[i]->Box.TransformBy(Boxes[i]->Matrix); }
+
+			PCGEX_MAKE_SHARED(NewBVH, FBoxBVH)
+			NewBVH->Build(WorldBoxes);
+			BVH = NewBVH;
+		}
+
 		bool FindIntersections(FIntersections* InIntersections) const
 		{
+			if (BVH)
+			{
+				BVH->FindSegmentIntersecting(
+					InIntersections->StartPosition, InIntersections->EndPosition,
+					[&](const int32 Item) { Boxes[Item]->ProcessIntersections(InIntersections); });
+				return !InIntersections->Cuts.IsEmpty();
+			}
+
 			const FBoxCenterAndExtent BCAE = InIntersections->GetBoxCenterAndExtent();
 			Octree->FindElementsWithBoundsTest(BCAE, [&](const FPointBox* NearbyBox) { NearbyBox->ProcessIntersections(InIntersections); });
 			return !InIntersections->Cuts.IsEmpty();
@@ -49,8 +49,15 @@ namespace PCGExCluster
 		bool Compile(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager);
 		bool CompileLeavesOnly(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager);
 
+		/** Whether a chain stops at that node : leaves, complex nodes & breakpoints. */
+		FORCEINLINE bool IsChainEnd(const FNode& Node) const { return !Node.IsBinary() || (Breakpoints && (*Breakpoints)[Node.PointIndex]); }
+
 	protected:
+		bool bLeavesOnly = false;
+
 		bool DispatchTasks(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager);
-		void Dedupe();
+
+		// A chain is found from both its ends; only the end that comes first in seeding order owns it.
+		bool IsChainOwner(const FNodeChain& Chain) const;
 	};
 }
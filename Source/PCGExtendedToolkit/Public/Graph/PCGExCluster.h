@@ -74,6 +74,7 @@ namespace PCGExCluster
 	};
 
 	class FCluster;
+	class FLandmarks;
 
 	struct PCGEXTENDEDTOOLKIT_API FNode : PCGExGraph::FNode
 	{
@@ -104,8 +105,10 @@ namespace PCGExCluster
 	{
 	protected:
 		bool bIsMirror = false;
+		bool bIsInstance = false; // Shares topology with OriginalCluster, positions are resolved on ExpandInstance
 
 		bool bEdgeLengthsDirty = true;
+		bool bSharesOriginalPositions = false; // Mirror reads the same points as OriginalCluster, landmarks are published there
 		TSharedPtr<FCluster> OriginalCluster = nullptr;
 
 		mutable FRWLock ClusterLock;
@@ -136,6 +139,8 @@ namespace PCGExCluster
 		TSharedPtr<PCGEx::FIndexedItemOctree> NodeOctree;
 		TSharedPtr<PCGEx::FIndexedItemOctree> EdgeOctree;
 
+		TSharedPtr<FLandmarks> Landmarks;
+
 		FCluster(const TSharedPtr<PCGExData::FPointIO>& InVtxIO, const TSharedPtr<PCGExData::FPointIO>& InEdgesIO,
 		         const TSharedPtr<PCGEx::FIndexLookup>& InNodeIndexLookup);
 		FCluster(const TSharedRef<FCluster>& OtherCluster,
@@ -143,6 +148,11 @@ namespace PCGExCluster
 		         const TSharedPtr<PCGEx::FIndexLookup>& InNodeIndexLookup,
 		         bool bCopyNodes, bool bCopyEdges, bool bCopyLookup);
 
+		/** Instance sharing nodes, edges and lookup with another cluster, bound to a transformed copy of its vtx/edges.
+		 * Positions are read from InVtxIO output points the first time the instance is expanded. */
+		FCluster(const TSharedRef<FCluster>& OtherCluster,
+		         const TSharedPtr<PCGExData::FPointIO>& InVtxIO, const TSharedPtr<PCGExData::FPointIO>& InEdgesIO);
+
 		void ClearInheritedForChanges(const bool bClearOwned = false);
 		void WillModifyVtxIO(const bool bClearOwned = false);
 		void WillModifyVtxPositions(const bool bClearOwned = false);
@@ -150,12 +160,15 @@ namespace PCGExCluster
 		~FCluster();
 
 		bool BuildFrom(
-			const TMap<uint32, int32>& InEndpointsLookup,
+			const PCGExGraph::FEndpointsLookup& InEndpointsLookup,
 			const TArray<int32>* InExpectedAdjacency,
 			const PCGExData::ESource PointsSource = PCGExData::ESource::In);
 
 		void BuildFrom(const TSharedRef<PCGExGraph::FSubGraph>& SubGraph);
 
+		bool IsInstance() const { return bIsInstance; }
+		void ExpandInstance();
+
 		bool IsValidWith(const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO) const;
 		bool HasTag(const FString& InTag);
 
@@ -415,6 +428,9 @@ namespace PCGExCluster
 		TSharedPtr<TArray<FBoundedEdge>> GetBoundedEdges(const bool bBuild);
 		void ExpandEdges(PCGExMT::FTaskManager* AsyncManager);
 
+		/** Landmark distances, built on first request and kept with the cluster until positions change. Mirrors sharing the original positions publish them to the original cluster. Thread-safe. */
+		TSharedPtr<FLandmarks> GetLandmarks(const int32 NumLandmarks);
+
 		template <typename T, class MakeFunc>
 		void GrabNeighbors(const int32 NodeIndex, TArray<T>& OutNeighbors, const MakeFunc&& Make) const
 		{
@@ -446,6 +462,39 @@ namespace PCGExCluster
 	};
 
 	void GetAdjacencyData(const FCluster* InCluster, FNode& InNode, TArray<FAdjacencyData>& OutData);
+
+	/**
+	 * ALT landmarks : shortest path lengths from a handful of well-spread nodes to every other node.
+	 * Triangle inequality turns them into a lower bound on the path length between any two nodes.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FLandmarks : public TSharedFromThis<FLandmarks>
+	{
+	public:
+		TArray<int32> Nodes;      // Landmark node indices
+		TArray<double> Distances; // Node-major, Stride distances per node. -1 if unreachable.
+		int32 Stride = 0;
+
+		FLandmarks() = default;
+
+		void Build(const FCluster* InCluster, const int32 InNumLandmarks);
+
+		FORCEINLINE int32 Num() const { return Nodes.Num(); }
+
+		FORCEINLINE double GetLowerBound(const int32 FromNode, const int32 ToNode) const
+		{
+			const double* A = Distances.GetData() + FromNode * Stride;
+			const double* B = Distances.GetData() + ToNode * Stride;
+
+			double Bound = 0;
+			for (int i = 0; i < Nodes.Num(); i++)
+			{
+				if (A[i] < 0 || B[i] < 0) { continue; }
+				Bound = FMath::Max(Bound, FMath::Abs(A[i] - B[i]));
+			}
+
+			return Bound;
+		}
+	};
 }
 
 USTRUCT(BlueprintType)
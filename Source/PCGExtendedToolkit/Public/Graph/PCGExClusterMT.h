@@ -4,6 +4,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Algo/BinarySearch.h"
 
 #include "PCGExEdge.h"
 #include "PCGExGraph.h"
@@ -76,6 +77,8 @@ namespace PCGExClusterMT
 
 		virtual TSharedPtr<PCGExCluster::FCluster> HandleCachedCluster(const TSharedRef<PCGExCluster::FCluster>& InClusterRef);
 
+		bool BuildCluster();
+
 		void ForwardCluster() const;
 
 	public:
@@ -98,7 +101,7 @@ namespace PCGExClusterMT
 
 		int32 BatchIndex = -1;
 
-		TMap<uint32, int32>* EndpointsLookup = nullptr;
+		PCGExGraph::FEndpointsLookup* EndpointsLookup = nullptr;
 		TArray<int32>* ExpectedAdjacency = nullptr;
 
 		TSharedPtr<PCGExCluster::FCluster> Cluster;
@@ -117,6 +120,9 @@ namespace PCGExClusterMT
 
 		void SetRequiresHeuristics(const bool bRequired, const TArray<TObjectPtr<const UPCGExHeuristicsFactoryData>>* InHeuristicsFactories);
 
+		/** Build the cluster ahead of Process and prepare its heuristics. Static edge scores still need to be baked before Process. */
+		bool PrepareHeuristics(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager);
+
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager> InAsyncManager);
 
 #pragma region Parallel loops
@@ -186,7 +192,7 @@ namespace PCGExClusterMT
 		const FPCGMetadataAttribute<int64>* RawLookupAttribute = nullptr;
 		TArray<uint32> ReverseLookup;
 
-		TMap<uint32, int32> EndpointsLookup;
+		PCGExGraph::FEndpointsLookup EndpointsLookup;
 		TArray<int32> ExpectedAdjacency;
 
 		bool bPreparationSuccessful = false;
@@ -256,6 +262,7 @@ namespace PCGExClusterMT
 	public:
 		TArray<TSharedRef<T>> Processors;
 		TArray<TSharedRef<T>> TrivialProcessors;
+		TArray<int32> HeuristicsEdgeOffsets; // Start of each processor's edges in the flattened heuristics bake, plus a trailing end offset
 
 		std::atomic<PCGEx::ContextState> CurrentState{PCGEx::State_InitialExecution};
 
@@ -314,7 +321,82 @@ namespace PCGExClusterMT
 				if (NewProcessor->IsTrivial()) { TrivialProcessors.Add(NewProcessor.ToSharedRef()); }
 			}
 
-			StartProcessing();
+			if (RequiresHeuristics()) { PrepareHeuristics(); }
+			else { StartProcessing(); }
+		}
+
+		virtual void PrepareHeuristics()
+		{
+			PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, PrepareHeuristicsTask)
+
+			PrepareHeuristicsTask->OnCompleteCallback =
+				[PCGEX_ASYNC_THIS_CAPTURE]()
+				{
+					PCGEX_ASYNC_THIS
+					This->BakeHeuristics();
+				};
+
+			PrepareHeuristicsTask->OnIterationCallback =
+				[PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
+				{
+					PCGEX_ASYNC_THIS
+					const TSharedRef<T>& Processor = This->Processors[Index];
+					Processor->bIsProcessorValid = Processor->PrepareHeuristics(This->AsyncManager);
+				};
+
+			PrepareHeuristicsTask->StartIterations(Processors.Num(), 1, false);
+		}
+
+		virtual void BakeHeuristics()
+		{
+			// Static edge scores are baked over the edges of all clusters at once, so a single large cluster is still split across tasks
+			HeuristicsEdgeOffsets.SetNumUninitialized(Processors.Num() + 1);
+
+			int32 NumEdges = 0;
+			for (int i = 0; i < Processors.Num(); i++)
+			{
+				HeuristicsEdgeOffsets[i] = NumEdges;
+				const TSharedRef<T>& Processor = Processors[i];
+				if (Processor->bIsProcessorValid && Processor->HeuristicsHandler) { NumEdges += Processor->Cluster->Edges->Num(); }
+			}
+
+			HeuristicsEdgeOffsets[Processors.Num()] = NumEdges;
+
+			if (!NumEdges)
+			{
+				StartProcessing();
+				return;
+			}
+
+			PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, BakeHeuristicsTask)
+
+			BakeHeuristicsTask->OnCompleteCallback =
+				[PCGEX_ASYNC_THIS_CAPTURE]()
+				{
+					PCGEX_ASYNC_THIS
+					This->StartProcessing();
+				};
+
+			BakeHeuristicsTask->OnSubLoopStartCallback =
+				[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+				{
+					PCGEX_ASYNC_THIS
+
+					const TArray<int32>& Offsets = This->HeuristicsEdgeOffsets;
+					int32 Index = Algo::UpperBound(Offsets, Scope.Start) - 1;
+					int32 Start = Scope.Start;
+
+					// A scope may span the tail of a cluster and the head of the next ones
+					while (Start < Scope.End)
+					{
+						const int32 End = FMath::Min(Scope.End, Offsets[Index + 1]);
+						if (End > Start) { This->Processors[Index]->HeuristicsHandler->BakeEdgeScores(PCGExMT::FScope(Start - Offsets[Index], End - Start)); }
+						Start = End;
+						Index++;
+					}
+				};
+
+			BakeHeuristicsTask->StartSubLoops(NumEdges, GetDefault<UPCGExGlobalSettings>()->GetClusterBatchChunkSize());
 		}
 
 		virtual void StartProcessing()
@@ -48,6 +48,10 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExTransformDetails TransformDetails;
 
+	/** Build each input cluster once and bind a lightweight instance of it to every copy. Downstream cluster nodes will fetch it from the cache instead of rebuilding one cluster per copy. Requires cluster caching to be enabled in the global settings. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, AdvancedDisplay)
+	bool bShareTopology = true;
+
 	/** */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, InlineEditConditionToggle))
 	bool bDoMatchByTags = false;
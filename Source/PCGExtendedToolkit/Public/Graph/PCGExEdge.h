@@ -113,6 +113,48 @@ namespace PCGExGraph
 		FORCEINLINE uint32 GetTypeHash(const FLink& Key) { return HashCombineFast(Key.Node, Key.Edge); }
 	};
 
+	/**
+	 * Maps vtx endpoint ids to point indices.
+	 * Ids that span a compact range are stored in a dense array indexed by (Id - Min),
+	 * otherwise in a flat open-addressing table. Insert is lock-free and can be called from parallel scopes;
+	 * lookups are only safe once all inserts are done. Duplicate ids resolve to the highest point index.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FEndpointsLookup
+	{
+		bool bDense = true;
+		uint32 Min = 0;
+		uint32 Mask = 0;
+		int32 NumEndpoints = 0;
+		TArray<int64> Slots; // Dense : point index, -1 if empty | Sparse : Id << 32 | (Index + 1), 0 if empty
+
+	public:
+		FEndpointsLookup() = default;
+
+		/** Prepare storage for the given ids. Must be called before any Insert. */
+		void Init(const TArrayView<const uint32> Ids);
+		void Insert(const uint32 Id, const int32 Index);
+		void Empty();
+
+		FORCEINLINE bool IsEmpty() const { return NumEndpoints == 0; }
+		FORCEINLINE int32 Num() const { return NumEndpoints; }
+
+		FORCEINLINE int32 Find(const uint32 Id) const
+		{
+			if (bDense)
+			{
+				const uint32 Local = Id - Min;
+				return Local < static_cast<uint32>(Slots.Num()) ? static_cast<int32>(Slots[Local]) : -1;
+			}
+
+			for (uint32 Slot = MurmurFinalize32(Id) & Mask;; Slot = (Slot + 1) & Mask)
+			{
+				const int64 Value = Slots[Slot];
+				if (!Value) { return -1; }
+				if (static_cast<uint32>(static_cast<uint64>(Value) >> 32) == Id) { return static_cast<int32>(static_cast<uint32>(Value)) - 1; }
+			}
+		}
+	};
+
 	void SetClusterVtx(const TSharedPtr<PCGExData::FPointIO>& IO, PCGExTags::IDType& OutId);
 	void MarkClusterVtx(const TSharedPtr<PCGExData::FPointIO>& IO, const PCGExTags::IDType& Id);
 	void MarkClusterEdges(const TSharedPtr<PCGExData::FPointIO>& IO, const PCGExTags::IDType& Id);
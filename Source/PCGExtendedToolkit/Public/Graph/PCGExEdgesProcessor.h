@@ -69,7 +69,7 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExEdgesProcessorContext : FPCGExPointsProcesso
 
 	TSharedPtr<PCGExData::FPointIOTaggedDictionary> InputDictionary;
 	TSharedPtr<PCGExData::FPointIOTaggedEntries> TaggedEdges;
-	TMap<uint32, int32> EndpointsLookup;
+	PCGExGraph::FEndpointsLookup EndpointsLookup;
 	TArray<int32> EndpointsAdjacency;
 
 	const TArray<FPCGExSortRuleConfig>* GetEdgeSortingRules() const;
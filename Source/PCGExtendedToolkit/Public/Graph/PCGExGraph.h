@@ -198,7 +198,7 @@ namespace PCGExGraph
 
 	bool BuildIndexedEdges(
 		const TSharedPtr<PCGExData::FPointIO>& EdgeIO,
-		const TMap<uint32, int32>& EndpointsLookup,
+		const FEndpointsLookup& EndpointsLookup,
 		TArray<FEdge>& OutEdges,
 		const bool bStopOnError = false);
 
@@ -304,8 +304,8 @@ namespace PCGExGraph
 	{
 	public:
 		TWeakPtr<FGraph> WeakParentGraph;
-		TSet<int32> Nodes;
-		TSet<int32> Edges;
+		TArray<int32> Nodes; // Sorted graph node indices
+		TArray<int32> Edges; // Sorted graph edge indices
 		TSet<int32> EdgesInIOIndices;
 		TSharedPtr<PCGExData::FFacade> VtxDataFacade;
 		TSharedPtr<PCGExData::FFacade> EdgesDataFacade;
@@ -318,8 +318,6 @@ namespace PCGExGraph
 
 		~FSubGraph() = default;
 
-		void Add(const FEdge& Edge, FGraph* InGraph);
-
 		void Invalidate(FGraph* InGraph);
 		void BuildCluster(const TSharedRef<PCGExCluster::FCluster>& InCluster);
 		int32 GetFirstInIOIndex();
@@ -507,7 +505,7 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 
 	bool BuildEndpointsLookup(
 		const TSharedPtr<PCGExData::FPointIO>& InPointIO,
-		TMap<uint32, int32>& OutIndices,
+		FEndpointsLookup& OutIndices,
 		TArray<int32>& OutAdjacency);
 
 #pragma endregion
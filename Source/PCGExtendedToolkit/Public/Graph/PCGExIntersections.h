@@ -9,6 +9,7 @@
 #include "PCGExEdge.h"
 #include "PCGExPointsProcessor.h"
 #include "PCGExDetails.h"
+#include "PCGExScopedContainers.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExDataForward.h"
 #include "Data/Blending/PCGExMetadataBlender.h"
@@ -208,6 +209,60 @@ namespace PCGExGraph
 
 #pragma endregion
 
+#pragma region Grid broadphase
+
+	/**
+	 * Uniform grid stored as flat, sorted cell runs.
+	 * Built once from a list of (cell, item) entries, then read concurrently without locking.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FIntersectionGrid : public TSharedFromThis<FIntersectionGrid>
+	{
+	public:
+		struct FEntry
+		{
+			uint64 Cell = 0;
+			int32 Item = -1;
+
+			FEntry() = default;
+
+			FEntry(const uint64 InCell, const int32 InItem)
+				: Cell(InCell), Item(InItem)
+			{
+			}
+		};
+
+		FIntersectionGrid(const FBox& InBounds, const double InCellSize);
+
+		FORCEINLINE double GetCellSize() const { return CellSize; }
+
+		uint64 GetCell(const FVector& Position) const;
+
+		/** Walk the cells traversed by a segment (3D DDA), expanded by a tolerance. Output is sorted and unique. */
+		void Rasterize(const FVector& A, const FVector& B, const double Expansion, TArray<uint64>& OutCells) const;
+
+		/** Sort entries by cell then item, and compact them into flat runs. */
+		void Build(TArray<FEntry>& InEntries);
+
+		TArrayView<const int32> GetItems(const uint64 Cell) const;
+
+	protected:
+		FVector Origin = FVector::ZeroVector;
+		double CellSize = 1;
+		double InvCellSize = 1;
+
+		TArray<uint64> Cells;
+		TArray<int32> Offsets;
+		TArray<int32> Items;
+
+		FIntVector GetCoords(const FVector& Position) const;
+		static uint64 GetCell(const FIntVector& Coords);
+		void AddBox(const FVector& A, const FVector& B, const double Expansion, TArray<uint64>& OutCells) const;
+	};
+
+	double ComputeGridCellSize(const TSharedPtr<FGraph>& InGraph, const TArray<FPCGPoint>& InPoints, const double InCellSize, const double InTolerance);
+
+#pragma endregion
+
 #pragma region Point Edge intersections
 
 	struct PCGEXTENDEDTOOLKIT_API FPESplit
@@ -264,12 +319,15 @@ namespace PCGExGraph
 		const FPCGExPointEdgeIntersectionDetails* Details;
 		TArray<FPointEdgeProxy> Edges;
 
+		TSharedPtr<FIntersectionGrid> Grid;
+
 		FPointEdgeIntersections(
 			const TSharedPtr<FGraph>& InGraph,
 			const TSharedPtr<PCGExData::FPointIO>& InPointIO,
 			const FPCGExPointEdgeIntersectionDetails* InDetails);
 
 		void Add(const int32 EdgeIndex, const FPESplit& Split);
+		FORCEINLINE void Add_Unsafe(const int32 EdgeIndex, const FPESplit& Split) { Edges[EdgeIndex].CollinearPoints.Add(Split); }
 		void Insert();
 		void BlendIntersection(const int32 Index, PCGExDataBlending::FMetadataBlender* Blender) const;
 
@@ -360,6 +418,9 @@ namespace PCGExGraph
 
 		TUniquePtr<FEdgeEdgeProxyOctree> Octree;
 
+		TSharedPtr<FIntersectionGrid> Grid;
+		TSharedPtr<PCGExMT::TScopedArray<FEESplit>> ScopedSplits;
+
 		FEdgeEdgeIntersections(
 			const TSharedPtr<FGraph>& InGraph,
 			const TSharedPtr<FUnionGraph>& InUnionGraph,
@@ -371,6 +432,9 @@ namespace PCGExGraph
 		void Add_Unsafe(const FEESplit& Split);
 		void BatchAdd(TArray<FEESplit>& Splits, const int32 A);
 
+		void PrepareScopes(const TArray<PCGExMT::FScope>& Loops);
+		void CommitScopedSplits();
+
 		bool InsertNodes() const;
 		void InsertEdges();
 
@@ -383,5 +447,10 @@ namespace PCGExGraph
 		const TSharedRef<FEdgeEdgeIntersections>& InIntersections,
 		const int32 EdgeIndex);
 
+	void FindOverlappingEdges(
+		const TSharedRef<FEdgeEdgeIntersections>& InIntersections,
+		const int32 EdgeIndex,
+		const PCGExMT::FScope& Scope);
+
 #pragma endregion
 }
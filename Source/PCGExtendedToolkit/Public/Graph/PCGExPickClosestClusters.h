@@ -9,6 +9,7 @@
 
 
 #include "Graph/PCGExEdgesProcessor.h"
+#include "Geometry/PCGExGeoBVH.h"
 #include "PCGExPickClosestClusters.generated.h"
 
 UENUM()
@@ -82,6 +83,15 @@ private:
 	friend class FPCGExPickClosestClustersElement;
 };
 
+namespace PCGExPickClosestClusters
+{
+	PCGEX_CTX_STATE(State_SearchingTargets)
+	PCGEX_CTX_STATE(State_Picking)
+	PCGEX_CTX_STATE(State_CompletingPicks)
+
+	class FProcessor;
+}
+
 struct FPCGExPickClosestClustersContext final : FPCGExEdgesProcessorContext
 {
 	friend class FPCGExPickClosestClustersElement;
@@ -94,7 +104,16 @@ struct FPCGExPickClosestClustersContext final : FPCGExEdgesProcessorContext
 	FPCGExAttributeToTagDetails TargetAttributesToTags;
 	TSharedPtr<PCGExData::FDataForwardHandler> TargetForwardHandler;
 
-	virtual void ClusterProcessing_InitialProcessingDone() override;
+	double TargetBoundsExpansion = 10;
+	bool bExpandSearchOutsideTargetBounds = true;
+
+	TArray<TSharedPtr<PCGExPickClosestClusters::FProcessor>> Processors;
+	TSharedPtr<PCGExGeo::FBoxBVH> ClusterBVH;
+	TArray<int32> Picks; // Best processor per target
+
+	bool StartSearch();
+	int32 FindBestPick(const int32 TargetIndex, const TBitArray<>* Excluded = nullptr) const;
+	void ApplyPicks();
 };
 
 class FPCGExPickClosestClustersElement final : public FPCGExEdgesProcessorElement
@@ -117,8 +136,6 @@ namespace PCGExPickClosestClusters
 		friend class FBatch;
 
 	public:
-		TArray<double> Distances;
-
 		int32 Picker = -1;
 
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade)
@@ -129,8 +146,17 @@ namespace PCGExPickClosestClusters
 		virtual ~FProcessor() override;
 
 		virtual bool Process(TSharedPtr<PCGExMT::FTaskManager> InAsyncManager) override;
-		void Search();
+
+		/** Squared distance from target to this cluster, MAX_dbl if nothing was found. Thread-safe. */
+		double GetDistance(const int32 TargetIndex);
+
 		virtual void CompleteWork() override;
+
+	protected:
+		FRWLock OctreeLock;
+		bool bOctreeReady = false;
+
+		void EnsureOctree();
 	};
 
 
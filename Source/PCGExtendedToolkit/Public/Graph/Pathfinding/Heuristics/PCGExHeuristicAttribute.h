@@ -53,6 +53,8 @@ public:
 		const PCGExCluster::FNode& Goal,
 		const TSharedPtr<PCGEx::FHashLookup> TravelStack) const override;
 
+	virtual bool IsEdgeScoreStatic() const override { return true; }
+
 	virtual void Cleanup() override;
 
 	EPCGExClusterComponentSource Source = EPCGExClusterComponentSource::Vtx;
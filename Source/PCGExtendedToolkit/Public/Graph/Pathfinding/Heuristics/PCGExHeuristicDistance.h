@@ -48,6 +48,8 @@ public:
 		const PCGExCluster::FNode& Goal,
 		const TSharedPtr<PCGEx::FHashLookup> TravelStack) const override;
 
+	virtual bool IsEdgeScoreStatic() const override { return true; }
+
 protected:
 	double BoundsSize = 0;
 };
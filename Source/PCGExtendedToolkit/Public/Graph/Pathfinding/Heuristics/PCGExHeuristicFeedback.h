@@ -70,6 +70,9 @@ public:
 		const PCGExCluster::FNode& Goal,
 		const TSharedPtr<PCGEx::FHashLookup> TravelStack) const override;
 
+	// Feedback only ever adds to scores, regardless of the query
+	virtual bool IsQueryIndependent() const override { return true; }
+
 	void FeedbackPointScore(const PCGExCluster::FNode& Node);
 
 	void FeedbackScore(const PCGExCluster::FNode& Node, const PCGExGraph::FEdge& Edge);
@@ -49,6 +49,11 @@ public:
 		const PCGExCluster::FNode& Goal,
 		const TSharedPtr<PCGEx::FHashLookup> TravelStack = nullptr) const;
 
+	/** Whether GetEdgeScore only depends on From, To & Edge, and can be baked once per cluster. */
+	virtual bool IsEdgeScoreStatic() const { return false; }
+
+	/** Whether GetEdgeScore ignores seed, goal & travel history, so a per-cluster lower bound holds for every query. */
+	virtual bool IsQueryIndependent() const { return IsEdgeScoreStatic(); }
 
 	double GetCustomWeightMultiplier(const int32 PointIndex, const int32 EdgeIndex) const;
 
@@ -63,6 +68,8 @@ public:
 protected:
 	TSharedPtr<const PCGExCluster::FCluster> Cluster;
 	TArray<double> LocalWeightMultiplier;
+	TArray<double> ScoreLUT;
 
+	void BuildScoreLUT();
 	virtual double GetScoreInternal(const double InTime) const;
 };
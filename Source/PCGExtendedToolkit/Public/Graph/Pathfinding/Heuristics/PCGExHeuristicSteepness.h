@@ -65,6 +65,8 @@ public:
 		const PCGExCluster::FNode& Goal,
 		const TSharedPtr<PCGEx::FHashLookup> TravelStack) const override;
 
+	virtual bool IsEdgeScoreStatic() const override { return !bAccumulate; }
+
 protected:
 	bool bAccumulate = false;
 	int32 MaxSamples = 1;
@@ -58,6 +58,8 @@ public:
 		const PCGExCluster::FNode& Goal,
 		const TSharedPtr<PCGEx::FHashLookup> TravelStack) const override;
 
+	virtual bool IsEdgeScoreStatic() const override { return true; }
+
 protected:
 	TSharedPtr<PCGExTensor::FTensorsHandler> TensorsHandler;
 	FPCGExTensorHandlerDetails TensorHandlerDetails;
@@ -81,6 +81,17 @@ namespace PCGExHeuristics
 		FPCGExContext* ExecutionContext = nullptr;
 		bool bIsValidHandler = false;
 
+		mutable double MinScorePerLength = -1;
+
+		// Flattened per-cluster pipeline : static scores & weights are baked per edge direction,
+		// only operations that depend on seed, goal or travel history are evaluated during search.
+		TArray<const UPCGExHeuristicOperation*> StaticOperations;
+		TArray<const UPCGExHeuristicOperation*> DynamicOperations;
+		TArray<double> StaticEdgeScores;
+		TArray<double> EdgeWeights;
+
+		FORCEINLINE static int32 GetEdgeSlot(const PCGExCluster::FNode& From, const PCGExGraph::FEdge& Edge) { return Edge.Index * 2 + (From.PointIndex == Edge.Start ? 0 : 1); }
+
 	public:
 		mutable FRWLock HandlerLock;
 		TSharedPtr<PCGExData::FFacade> VtxDataFacade;
@@ -100,6 +111,7 @@ namespace PCGExHeuristics
 		bool HasGlobalFeedback() const { return !Feedbacks.IsEmpty(); };
 		bool HasLocalFeedback() const { return !LocalFeedbackFactories.IsEmpty(); };
 		bool HasAnyFeedback() const { return HasGlobalFeedback() || HasLocalFeedback(); };
+		bool IsQueryIndependent() const;
 
 		FHeuristicsHandler(FPCGExContext* InContext, const TSharedPtr<PCGExData::FFacade>& InVtxDataCache, const TSharedPtr<PCGExData::FFacade>& InEdgeDataCache, const TArray<TObjectPtr<const UPCGExHeuristicsFactoryData>>& InFactories);
 		~FHeuristicsHandler();
@@ -107,6 +119,7 @@ namespace PCGExHeuristics
 		bool BuildFrom(FPCGExContext* InContext, const TArray<TObjectPtr<const UPCGExHeuristicsFactoryData>>& InFactories);
 		void PrepareForCluster(const TSharedPtr<PCGExCluster::FCluster>& InCluster);
 		void CompleteClusterPreparation();
+		void BakeEdgeScores(const PCGExMT::FScope& Scope); // Must be run over every edge once CompleteClusterPreparation is done, before any scoring
 
 
 		double GetGlobalScore(
@@ -136,12 +149,14 @@ namespace PCGExHeuristics
 			const FLocalFeedbackHandler* LocalFeedback = nullptr,
 			const TSharedPtr<PCGEx::FHashLookup> TravelStack = nullptr) const
 		{
-			double EScore = 0;
-			double EWeight = TotalStaticWeight;
+			const int32 Slot = GetEdgeSlot(From, Edge);
+
+			double EScore = StaticEdgeScores[Slot];
+			for (const UPCGExHeuristicOperation* Op : DynamicOperations) { EScore += Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack); }
 
 			if (!bUseDynamicWeight)
 			{
-				for (const UPCGExHeuristicOperation* Op : Operations) { EScore += Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack); }
+				double EWeight = TotalStaticWeight;
 
 				if (LocalFeedback)
 				{
@@ -152,23 +167,19 @@ namespace PCGExHeuristics
 				return EScore / EWeight;
 			}
 
-			EWeight = 0;
-
-			for (const UPCGExHeuristicOperation* Op : Operations)
-			{
-				EScore += Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack);
-				EWeight += (Op->WeightFactor * Op->GetCustomWeightMultiplier(To.Index, Edge.PointIndex));
-			}
-
 			if (LocalFeedback)
 			{
 				EScore += LocalFeedback->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack);
 				//EWeight += LocalFeedback->TotalStaticWeight;
 			}
 
-			return EScore / EWeight;
+			return EScore / EdgeWeights[Slot];
 		}
 
+		/** Lowest edge score per unit of edge length over the cluster, feedback excluded. Converts length lower bounds into score lower bounds.
+		 * Zero if any operation depends on the query (seed, goal or travel history), as no sampled bound would hold for every query. */
+		double GetMinScorePerLength() const;
+
 		void FeedbackPointScore(const PCGExCluster::FNode& Node)
 		{
 			for (UPCGExHeuristicFeedback* Op : Feedbacks) { Op->FeedbackPointScore(Node); }
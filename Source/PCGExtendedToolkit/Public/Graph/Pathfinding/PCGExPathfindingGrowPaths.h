@@ -68,6 +68,7 @@ namespace PCGExGrowPaths
 		double Distance = 0;
 
 		TArray<int32> Path;
+		TBitArray<> Visited; // Cluster node index -> is part of Path
 
 		FGrowth(
 			const TSharedPtr<FProcessor>& InProcessor,
@@ -296,7 +297,13 @@ namespace PCGExGrowPaths
 
 		virtual bool Process(TSharedPtr<PCGExMT::FTaskManager> InAsyncManager) override;
 		virtual void CompleteWork() override;
+
+		void StartGrowth();
 		void Grow();
+
+	protected:
+		void StepGrowths();
+		void CommitGrowthStep();
 	};
 
 	class FGrowTask final : public PCGExMT::FTask
@@ -59,6 +59,24 @@ namespace PCGExSearch
 			return true;
 		}
 
+		/** Lowest live score without removing it. Stale entries found on top are discarded. */
+		bool Peek(double& OutScore)
+		{
+			while (!InternalQueue.empty())
+			{
+				const FScoredNode& TopNode = InternalQueue.top();
+				if (TopNode.Score == Scores[TopNode.Id])
+				{
+					OutScore = TopNode.Score;
+					return true;
+				}
+
+				InternalQueue.pop();
+			}
+
+			return false;
+		}
+
 		bool Dequeue(int32& Item, double& OutScore)
 		{
 			//TRACE_CPUPROFILER_EVENT_SCOPE(ScoredQueue::Dequeue);
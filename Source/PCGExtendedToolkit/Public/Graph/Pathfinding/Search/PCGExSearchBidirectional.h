@@ -0,0 +1,34 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExSearchOperation.h"
+
+
+#include "UObject/Object.h"
+#include "PCGExSearchBidirectional.generated.h"
+
+class UPCGExHeuristicOperation;
+/**
+ * 
+ */
+UCLASS(MinimalAPI, DisplayName = "Bidirectional", meta=(ToolTip ="Bidirectional search. Expands from both seed and goal until the two fronts meet; explores far fewer nodes on long queries."))
+class UPCGExSearchBidirectional : public UPCGExSearchOperation
+{
+	GENERATED_BODY()
+
+public:
+	/** Guide both fronts with heuristics global scores (A*-like), otherwise behaves like a bidirectional Dijkstra.
+	 * Result is only guaranteed to be the best path if heuristics are consistent. Path-dependent heuristics (inertia, accumulated steepness) are only accounted for on the seed side. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
+	bool bUseGlobalScores = true;
+
+	virtual void CopySettingsFrom(const UPCGExOperation* Other) override;
+
+	virtual bool ResolveQuery(
+		const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
+		const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& Heuristics,
+		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback) const override;
+};
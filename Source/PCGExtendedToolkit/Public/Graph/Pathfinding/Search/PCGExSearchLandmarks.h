@@ -0,0 +1,38 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExSearchOperation.h"
+
+
+#include "UObject/Object.h"
+#include "PCGExSearchLandmarks.generated.h"
+
+class UPCGExHeuristicOperation;
+/**
+ * 
+ */
+UCLASS(MinimalAPI, DisplayName = "A* (Landmarks)", meta=(ToolTip ="A* guided by landmark distances (ALT) precomputed once per cluster. Best suited for many queries over the same large cluster. Heuristics that depend on seed, goal or travel history (e.g. Azimuth, Inertia) disable the landmark estimate and fall back to a plain shortest-path search."))
+class UPCGExSearchLandmarks : public UPCGExSearchOperation
+{
+	GENERATED_BODY()
+
+public:
+	/** Number of landmarks to compute. More landmarks yield tighter estimates at the cost of memory (one distance per node per landmark) and preprocessing. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable, ClampMin=1, ClampMax=32))
+	int32 NumLandmarks = 8;
+
+	virtual void CopySettingsFrom(const UPCGExOperation* Other) override;
+
+	virtual void PrepareForCluster(PCGExCluster::FCluster* InCluster) override;
+
+	virtual bool ResolveQuery(
+		const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
+		const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& Heuristics,
+		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback) const override;
+
+protected:
+	TSharedPtr<PCGExCluster::FLandmarks> Landmarks;
+};
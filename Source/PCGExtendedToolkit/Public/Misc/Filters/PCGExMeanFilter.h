@@ -34,6 +34,10 @@ struct FPCGExMeanFilterConfig
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	EPCGExMeanMethod MeanMethod = EPCGExMeanMethod::Average;
 
+	/** How the mean is computed. Sketch avoids copying & sorting values, at the cost of an approximate median. Mode methods always use exact values. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditConditionHides, EditCondition="MeanMethod==EPCGExMeanMethod::Average || MeanMethod==EPCGExMeanMethod::Median"))
+	EPCGExStatsPrecision Precision = EPCGExStatsPrecision::Exact;
+
 	/** Minimum value threshold */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditConditionHides, EditCondition="MeanMethod==EPCGExMeanMethod::Fixed", ClampMin=0))
 	double MeanValue = 0;
@@ -88,7 +92,7 @@ namespace PCGExPointFilter
 
 		const TObjectPtr<const UPCGExMeanFilterFactory> TypedFilterFactory;
 
-		TArray<double> Values;
+		TSharedPtr<PCGExData::TBuffer<double>> Target;
 
 		double DataMin = 0;
 		double DataMax = 0;
@@ -97,6 +101,8 @@ namespace PCGExPointFilter
 		double ReferenceMin = 0;
 		double ReferenceMax = 0;
 
+		double Divider = 1; // Relative measure normalizes by DataMax
+
 		virtual bool Init(FPCGExContext* InContext, const TSharedPtr<PCGExData::FFacade>& InPointDataFacade) override;
 		virtual void PostInit() override;
 
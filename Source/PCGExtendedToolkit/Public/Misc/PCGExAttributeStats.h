@@ -11,6 +11,8 @@
 
 
 #include "Sampling/PCGExSampling.h"
+#include "PCGExScopedContainers.h"
+#include "PCGExStatsSketch.h"
 
 
 #include "PCGExAttributeStats.generated.h"
@@ -55,6 +57,11 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExNameFiltersDetails Filters = FPCGExNameFiltersDetails(true);
 
+	/** Sketch processes points per-scope in parallel and estimates distinct counts instead of counting every value.
+	 * Unique-value outputs (unique nums, has only unique values, per-unique values stats) require exact counting; attributes fall back to exact when any of those is enabled. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
+	EPCGExStatsPrecision Precision = EPCGExStatsPrecision::Exact;
+
 	/** */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	bool bOutputPerUniqueValuesStats = false;
@@ -224,6 +231,11 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable))
 	bool bFeedbackLoopFailsafe = true;
 
+	bool NeedsExactCounts() const
+	{
+		return bOutputPerUniqueValuesStats || bOutputUniqueValuesNum || bOutputUniqueSetValuesNum || bOutputHasOnlyUniqueValues;
+	}
+
 private:
 	friend class FPCGExAttributeStatsElement;
 };
@@ -275,8 +287,33 @@ namespace PCGExAttributeStats
 			const TArray<int8>& Filter)
 		{
 		}
+
+		/** Fetch inputs for per-scope processing. Returns false if this attribute must go through the exact Process. */
+		virtual bool PrepareSketch(const TSharedRef<PCGExData::FFacade>& InDataFacade) { return false; }
+		virtual void PrepareScopes(const int32 NumScopes)
+		{
+		}
+
+		virtual void ProcessScope(const PCGExMT::FScope& Scope, const TArray<int8>& Filter)
+		{
+		}
+
+		virtual void CompleteSketch(
+			const TSharedRef<PCGExData::FFacade> InDataFacade,
+			FPCGExAttributeStatsContext* Context,
+			const UPCGExAttributeStatsSettings* Settings)
+		{
+		}
 	};
 
+#define PCGEX_OUTPUT_STAT(_NAME, _TYPE, _VALUE) \
+	if(Settings->bOutput##_NAME){ ParamData->Metadata->GetMutableTypedAttribute<_TYPE>(Settings->_NAME##AttributeName)->SetValue(Key, _VALUE); \
+	if(Settings->OutputToTags != EPCGExStatsOutputToPoints::None){ InDataFacade->Source->Tags->Set<_TYPE>(Settings->OutputToTags == EPCGExStatsOutputToPoints::Prefix ? (Settings->_NAME##AttributeName.ToString() + StrName) : (StrName + Settings->_NAME##AttributeName.ToString()), _VALUE); } \
+	if (PointsMetadata){\
+		FName PrintName = Settings->OutputToPoints == EPCGExStatsOutputToPoints::Prefix ? FName(Settings->_NAME##AttributeName.ToString() + StrName) : FName(StrName + Settings->_NAME##AttributeName.ToString());\
+		if (PointsMetadata->GetConstTypedAttribute<_TYPE>(PrintName)) { PointsMetadata->DeleteAttribute(PrintName); }\
+		PointsMetadata->FindOrCreateAttribute<_TYPE>(PrintName, _VALUE);} }
+
 	template <typename T>
 	class TAttributeStats : public FAttributeStatsBase
 	{
@@ -295,6 +332,24 @@ namespace PCGExAttributeStats
 		int32 DifferentValuesNum = 0;
 		int32 DifferentSetValuesNum = 0;
 		int32 DefaultValuesNum = 0;
+		int32 NumValues = 0;
+
+		TSharedPtr<PCGExData::TBuffer<T>> Buffer;
+
+		struct FScopedStats
+		{
+			T MinValue = T{};
+			T MaxValue = T{};
+			T SetMinValue = T{};
+			T SetMaxValue = T{};
+			T SumValue = T{};
+			int32 NumValues = 0;
+			int32 DefaultValuesNum = 0;
+			PCGExStats::FHyperLogLog Values;
+			PCGExStats::FHyperLogLog SetValues;
+		};
+
+		TArray<FScopedStats> ScopedStats;
 
 		explicit TAttributeStats(const PCGEx::FAttributeIdentity& InIdentity, const int64 InKey)
 			: FAttributeStatsBase(InIdentity, InKey)
@@ -314,14 +369,7 @@ namespace PCGExAttributeStats
 
 			if (Settings->OutputToPoints != EPCGExStatsOutputToPoints::None) { PointsMetadata = InDataFacade->GetOut()->Metadata; }
 
-#define PCGEX_OUTPUT_STAT(_NAME, _TYPE, _VALUE) \
-	if(Settings->bOutput##_NAME){ ParamData->Metadata->GetMutableTypedAttribute<_TYPE>(Settings->_NAME##AttributeName)->SetValue(Key, _VALUE); \
-	if(Settings->OutputToTags != EPCGExStatsOutputToPoints::None){ InDataFacade->Source->Tags->Set<_TYPE>(Settings->OutputToTags == EPCGExStatsOutputToPoints::Prefix ? (Settings->_NAME##AttributeName.ToString() + StrName) : (StrName + Settings->_NAME##AttributeName.ToString()), _VALUE); } \
-	if (PointsMetadata){\
-		FName PrintName = Settings->OutputToPoints == EPCGExStatsOutputToPoints::Prefix ? FName(Settings->_NAME##AttributeName.ToString() + StrName) : FName(StrName + Settings->_NAME##AttributeName.ToString());\
-		if (PointsMetadata->GetConstTypedAttribute<_TYPE>(PrintName)) { PointsMetadata->DeleteAttribute(PrintName); }\
-		PointsMetadata->FindOrCreateAttribute<_TYPE>(PrintName, _VALUE);} }
-			TSharedPtr<PCGExData::TBuffer<T>> Buffer = InDataFacade->GetReadable<T>(Identity.Name);
+			Buffer = InDataFacade->GetReadable<T>(Identity.Name);
 			PCGExMath::TypeMinMax(MinValue, MaxValue);
 			PCGExMath::TypeMinMax(SetMinValue, SetMaxValue);
 
@@ -357,7 +405,7 @@ namespace PCGExAttributeStats
 				SetValuesCount.Reserve(NumPoints);
 
 				DefaultValue = Buffer->GetTypedInAttribute()->GetValueFromItemKey(PCGDefaultValueKey);
-				int32 NumValues = 0;
+				NumValues = 0;
 
 				/*
 				auto ProcessBasics = [&](const T& InValue)
@@ -440,7 +488,125 @@ namespace PCGExAttributeStats
 				ValuesCount.Empty();
 				SetValuesCount.Empty();
 
-				////// OUTPUT
+				Output(InDataFacade, Context, Settings);
+			}
+		}
+
+		virtual bool PrepareSketch(const TSharedRef<PCGExData::FFacade>& InDataFacade) override
+		{
+			if constexpr (!PCGEx::IsValidForTMap<T>::value) { return false; }
+			else
+			{
+				Buffer = InDataFacade->GetReadable<T>(Identity.Name);
+				if (!Buffer) { return false; }
+
+				DefaultValue = Buffer->GetTypedInAttribute()->GetValueFromItemKey(PCGDefaultValueKey);
+				return true;
+			}
+		}
+
+		virtual void PrepareScopes(const int32 NumScopes) override
+		{
+			FScopedStats Initial;
+			PCGExMath::TypeMinMax(Initial.MinValue, Initial.MaxValue);
+			PCGExMath::TypeMinMax(Initial.SetMinValue, Initial.SetMaxValue);
+			ScopedStats.Init(Initial, NumScopes);
+		}
+
+		virtual void ProcessScope(const PCGExMT::FScope& Scope, const TArray<int8>& Filter) override
+		{
+			if constexpr (PCGEx::IsValidForTMap<T>::value)
+			{
+				FScopedStats& Partial = ScopedStats[Scope.LoopIndex];
+
+				for (int i = Scope.Start; i < Scope.End; i++)
+				{
+					if (!Filter[i]) { continue; }
+					Partial.NumValues++;
+
+					const T& Value = Buffer->Read(i);
+					const uint32 Hash = GetTypeHash(Value);
+
+					Partial.MinValue = PCGExBlend::Min(Partial.MinValue, Value);
+					Partial.MaxValue = PCGExBlend::Max(Partial.MaxValue, Value);
+					Partial.SumValue = PCGExBlend::Add(Partial.SumValue, Value);
+					Partial.Values.Add(Hash);
+
+					if (PCGExCompare::StrictlyEqual(Value, DefaultValue))
+					{
+						Partial.DefaultValuesNum++;
+					}
+					else
+					{
+						Partial.SetValues.Add(Hash);
+						Partial.SetMinValue = PCGExBlend::Min(Partial.SetMinValue, Value);
+						Partial.SetMaxValue = PCGExBlend::Max(Partial.SetMaxValue, Value);
+					}
+				}
+			}
+		}
+
+		virtual void CompleteSketch(
+			const TSharedRef<PCGExData::FFacade> InDataFacade,
+			FPCGExAttributeStatsContext* Context,
+			const UPCGExAttributeStatsSettings* Settings) override
+		{
+			if constexpr (PCGEx::IsValidForTMap<T>::value)
+			{
+				if (ScopedStats.IsEmpty()) { return; }
+
+				// Merge in scope order so floating point sums are deterministic
+				FScopedStats& Merged = ScopedStats[0];
+				for (int i = 1; i < ScopedStats.Num(); i++)
+				{
+					const FScopedStats& Partial = ScopedStats[i];
+					Merged.MinValue = PCGExBlend::Min(Merged.MinValue, Partial.MinValue);
+					Merged.MaxValue = PCGExBlend::Max(Merged.MaxValue, Partial.MaxValue);
+					Merged.SetMinValue = PCGExBlend::Min(Merged.SetMinValue, Partial.SetMinValue);
+					Merged.SetMaxValue = PCGExBlend::Max(Merged.SetMaxValue, Partial.SetMaxValue);
+					Merged.SumValue = PCGExBlend::Add(Merged.SumValue, Partial.SumValue);
+					Merged.NumValues += Partial.NumValues;
+					Merged.DefaultValuesNum += Partial.DefaultValuesNum;
+					Merged.Values.Merge(Partial.Values);
+					Merged.SetValues.Merge(Partial.SetValues);
+				}
+
+				MinValue = Merged.MinValue;
+				MaxValue = Merged.MaxValue;
+				SetMinValue = Merged.SetMinValue;
+				SetMaxValue = Merged.SetMaxValue;
+				AverageValue = Merged.SumValue;
+				NumValues = Merged.NumValues;
+				DefaultValuesNum = Merged.DefaultValuesNum;
+				DifferentValuesNum = NumValues > 0 ? FMath::Min(NumValues, Merged.Values.GetEstimate()) : 0;
+				DifferentSetValuesNum = NumValues > DefaultValuesNum ? FMath::Min(NumValues - DefaultValuesNum, Merged.SetValues.GetEstimate()) : 0;
+
+				ScopedStats.Empty();
+
+				UPCGParamData* ParamData = Context->OutputParamsMap[Identity.Name];
+				FString StrName = Identity.Name.ToString();
+				UPCGMetadata* PointsMetadata = nullptr;
+				if (Settings->OutputToPoints != EPCGExStatsOutputToPoints::None) { PointsMetadata = InDataFacade->GetOut()->Metadata; }
+
+				const FString Identifier = FString::Printf(TEXT("PCGEx/Identifier:%u"), InDataFacade->Source->GetIn()->GetUniqueID());
+				PCGEX_OUTPUT_STAT(Identifier, FString, Identifier)
+
+				Output(InDataFacade, Context, Settings);
+			}
+		}
+
+	protected:
+		void Output(
+			const TSharedRef<PCGExData::FFacade>& InDataFacade,
+			FPCGExAttributeStatsContext* Context,
+			const UPCGExAttributeStatsSettings* Settings)
+		{
+			if constexpr (PCGEx::IsValidForTMap<T>::value)
+			{
+				UPCGParamData* ParamData = Context->OutputParamsMap[Identity.Name];
+				FString StrName = Identity.Name.ToString();
+				UPCGMetadata* PointsMetadata = nullptr;
+				if (Settings->OutputToPoints != EPCGExStatsOutputToPoints::None) { PointsMetadata = InDataFacade->GetOut()->Metadata; }
 
 				PCGEX_OUTPUT_STAT(DefaultValue, T, DefaultValue)
 				PCGEX_OUTPUT_STAT(MinValue, T, MinValue)
@@ -458,15 +624,17 @@ namespace PCGExAttributeStats
 				PCGEX_OUTPUT_STAT(HasOnlyUniqueValues, bool, NumValues == UniqueSetValuesNum)
 				PCGEX_OUTPUT_STAT(Samples, int32, NumValues)
 				PCGEX_OUTPUT_STAT(IsValid, bool, true)
-
-#undef PCGEX_OUTPUT_STAT
 			}
 		}
 	};
 
+#undef PCGEX_OUTPUT_STAT
+
 	class FProcessor final : public PCGExPointsMT::TPointsProcessor<FPCGExAttributeStatsContext, UPCGExAttributeStatsSettings>
 	{
 		TArray<TSharedPtr<FAttributeStatsBase>> Stats;
+		TArray<TSharedPtr<FAttributeStatsBase>> ExactStats;
+		TArray<TSharedPtr<FAttributeStatsBase>> SketchStats;
 		TMap<FName, int32> PerAttributeStatMap;
 		TArray<UPCGParamData*> PerAttributeStats;
 
@@ -156,13 +156,7 @@ struct FPCGExDiscardByOverlapContext final : FPCGExPointsProcessorContext
 {
 	friend class FPCGExDiscardByOverlapElement;
 
-	mutable FRWLock OverlapLock;
-	TMap<uint64, TSharedPtr<PCGExDiscardByOverlap::FOverlap>> OverlapMap;
-
-	TSharedPtr<PCGExDiscardByOverlap::FOverlap> RegisterOverlap(
-		PCGExDiscardByOverlap::FProcessor* InA,
-		PCGExDiscardByOverlap::FProcessor* InB,
-		const FBox& InIntersection);
+	virtual void BatchProcessing_InitialProcessingDone() override;
 
 	FPCGExOverlapScoresWeighting Weights;
 	FPCGExOverlapScoresWeighting MaxScores;
@@ -291,7 +285,6 @@ namespace PCGExDiscardByOverlap
 
 		TArray<TSharedPtr<FPointBounds>> LocalPointBounds;
 
-		mutable FRWLock RegistrationLock;
 		TArray<TSharedPtr<FOverlap>> Overlaps;
 		TArray<TSharedPtr<FOverlap>> ManagedOverlaps;
 
@@ -322,7 +315,6 @@ namespace PCGExDiscardByOverlap
 
 		FORCEINLINE bool HasOverlaps() const { return !Overlaps.IsEmpty(); }
 
-		void RegisterOverlap(FProcessor* InOtherProcessor, const FBox& Intersection);
 		void RemoveOverlap(const TSharedPtr<FOverlap>& InOverlap, TArray<FProcessor*>& Stack);
 		void Prune(TArray<FProcessor*>& Stack);
 
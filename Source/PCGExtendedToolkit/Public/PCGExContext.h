@@ -156,7 +156,7 @@ protected:
 #pragma region Managed Components
 
 public:
-	UPCGManagedComponent* AttachManagedComponent(AActor* InParent, UActorComponent* InComponent, const FAttachmentTransformRules& AttachmentRules) const;
+	UPCGManagedComponent* AttachManagedComponent(AActor* InParent, UActorComponent* InComponent, const FAttachmentTransformRules& AttachmentRules, const TSubclassOf<UPCGManagedComponent>& InManagedClass = nullptr) const;
 
 #pragma endregion
 
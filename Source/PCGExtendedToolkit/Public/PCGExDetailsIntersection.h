@@ -11,6 +11,13 @@
 
 #include "PCGExDetailsIntersection.generated.h"
 
+UENUM()
+enum class EPCGExIntersectionBroadphase : uint8
+{
+	Octree = 0 UMETA(DisplayName = "Octree", Tooltip="Query an octree for each edge. Good for sparse inputs."),
+	Grid   = 1 UMETA(DisplayName = "Grid", Tooltip="Rasterize edges into a uniform grid and test per-cell candidates without locking. Much faster on dense inputs."),
+};
+
 USTRUCT(BlueprintType)
 struct PCGEXTENDEDTOOLKIT_API FPCGExUnionMetadataDetails
 {
@@ -96,6 +103,14 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExPointEdgeIntersectionDetails
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
 	bool bSnapOnEdge = false;
 
+	/** How candidate points are found for each edge. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable))
+	EPCGExIntersectionBroadphase Broadphase = EPCGExIntersectionBroadphase::Octree;
+
+	/** Grid cell size. Use 0 to derive it from the average edge length. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="Broadphase==EPCGExIntersectionBroadphase::Grid", EditConditionHides, ClampMin=0))
+	double GridCellSize = 0;
+
 	/**  */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Metadata", meta=(PCG_Overridable, InlineEditConditionToggle))
 	bool bWriteIsIntersector = false;
@@ -145,6 +160,14 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExEdgeEdgeIntersectionDetails
 	double MaxAngle = 90;
 	double MaxDot = 1;
 
+	/** How candidate edges are found for each edge. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable))
+	EPCGExIntersectionBroadphase Broadphase = EPCGExIntersectionBroadphase::Octree;
+
+	/** Grid cell size. Use 0 to derive it from the average edge length. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="Broadphase==EPCGExIntersectionBroadphase::Grid", EditConditionHides, ClampMin=0))
+	double GridCellSize = 0;
+
 	//
 
 	/**  */
@@ -30,6 +30,13 @@ enum class EPCGExMeanMethod : uint8
 	Fixed   = 5 UMETA(DisplayName = "Fixed", ToolTip="Fixed threshold"),
 };
 
+UENUM()
+enum class EPCGExStatsPrecision : uint8
+{
+	Exact  = 0 UMETA(DisplayName = "Exact", ToolTip="Materialize every value. Exact, but memory and time grow with the number of points."),
+	Sketch = 1 UMETA(DisplayName = "Sketch", ToolTip="Streaming sketches (Welford, t-digest, HyperLogLog) instead of materialized values. Bounded memory, approximate quantiles & distinct counts. Attribute Stats fills one sketch per scope and merges them; the Mean filter fills a single sketch in one pass."),
+};
+
 UENUM()
 enum class EPCGExPointBoundsSource : uint8
 {
@@ -74,6 +74,9 @@ public:
 
 	virtual PCGExData::EIOInit GetMainOutputInitMode() const;
 
+	/** Init mode for processors that would otherwise duplicate their input; Stream if supported & enabled. */
+	PCGExData::EIOInit GetDuplicateInitMode() const { return bSupportStreaming && bStreamOutput ? PCGExData::EIOInit::Stream : PCGExData::EIOInit::Duplicate; }
+
 	virtual FName GetPointFilterPin() const { return NAME_None; }
 	virtual FString GetPointFilterTooltip() const { return TEXT("Filters"); }
 	virtual TSet<PCGExFactories::EType> GetPointFilterTypes() const { return PCGExFactories::PointFilters; }
@@ -101,6 +104,13 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay))
 	EPCGExOptionState ScopedAttributeGet = EPCGExOptionState::Default;
 
+	UPROPERTY()
+	bool bSupportStreaming = false;
+
+	/** Copy input points into the output scope by scope while processing, instead of duplicating the whole input upfront. The output point array is still allocated at full size and metadata is inherited from the input just like a regular duplicate, so this does not lower peak memory; it only defers the point copy so it overlaps processing. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, EditCondition="bSupportStreaming", EditConditionHides, HideEditConditionToggle, AdvancedDisplay))
+	bool bStreamOutput = false;
+
 	/** If the node registers consumable attributes, these will be deleted from the output data. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Cleanup", meta=(PCG_NotOverridable))
 	bool bCleanupConsumableAttributes = false;
@@ -256,6 +256,9 @@ namespace PCGExSorting
 	void PrepareRulesAttributeBuffers(FPCGExContext* InContext, const FName InLabel, PCGExData::FFacadePreloader& FacadePreloader);
 
 	void RegisterBuffersDependencies(FPCGExContext* InContext, PCGExData::FFacadePreloader& FacadePreloader, const TArray<FPCGExSortRuleConfig>& InRuleConfigs);
+
+	/** Ascending LSD radix sort, linear in the number of values. */
+	PCGEXTENDEDTOOLKIT_API void RadixSort(TArray<uint32>& InOutValues);
 }
 
 #undef PCGEX_UNSUPPORTED_STRING_TYPES
@@ -0,0 +1,125 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExStats
+{
+	/**
+	 * Streaming mean & variance.
+	 * Partial accumulators built on separate scopes can be merged in any order (Chan et al.)
+	 */
+	struct PCGEXTENDEDTOOLKIT_API FWelford
+	{
+		int64 Count = 0;
+		double Mean = 0;
+		double M2 = 0;
+		double Min = MAX_dbl;
+		double Max = -MAX_dbl;
+
+		FORCEINLINE void Add(const double Value)
+		{
+			Count++;
+			const double Delta = Value - Mean;
+			Mean += Delta / static_cast<double>(Count);
+			M2 += Delta * (Value - Mean);
+			Min = FMath::Min(Min, Value);
+			Max = FMath::Max(Max, Value);
+		}
+
+		void Merge(const FWelford& Other);
+
+		FORCEINLINE bool IsEmpty() const { return Count == 0; }
+		FORCEINLINE double GetVariance() const { return Count > 1 ? M2 / static_cast<double>(Count - 1) : 0; }
+		FORCEINLINE double GetStdDev() const { return FMath::Sqrt(GetVariance()); }
+	};
+
+	/**
+	 * Merging t-digest.
+	 * Bounded-size quantile sketch; accuracy is best near the tails and remains well within a percent around the median.
+	 * Digests built on separate scopes can be merged together.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FTDigest
+	{
+	public:
+		explicit FTDigest(const double InCompression = 100);
+
+		void Add(const double Value, const double Weight = 1);
+		void Merge(const FTDigest& Other);
+
+		/** Estimated value at the given quantile (0..1). Flushes pending values. */
+		double Quantile(const double Q);
+
+		FORCEINLINE double GetTotalWeight() const { return MergedWeight + UnmergedWeight; }
+		FORCEINLINE bool IsEmpty() const { return GetTotalWeight() <= 0; }
+
+	protected:
+		struct FCentroid
+		{
+			double Mean = 0;
+			double Weight = 0;
+
+			FCentroid() = default;
+
+			FCentroid(const double InMean, const double InWeight)
+				: Mean(InMean), Weight(InWeight)
+			{
+			}
+		};
+
+		double Compression = 100;
+		int32 MaxUnmerged = 500;
+
+		TArray<FCentroid> Centroids;
+		TArray<FCentroid> Unmerged;
+		double MergedWeight = 0;
+		double UnmergedWeight = 0;
+		double Min = MAX_dbl;
+		double Max = -MAX_dbl;
+
+		void Compress();
+	};
+
+	/**
+	 * HyperLogLog distinct-count estimator.
+	 * Fixed memory (2^Precision bytes), ~1.04/sqrt(2^Precision) relative error. Register-wise max merge.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FHyperLogLog
+	{
+	public:
+		explicit FHyperLogLog(const int32 InPrecision = 12);
+
+		FORCEINLINE void Add(const uint32 Hash) { AddHash64(Mix(Hash)); }
+
+		FORCEINLINE void AddHash64(const uint64 Hash)
+		{
+			const uint64 Index = Hash >> (64 - Precision);
+			const uint64 Remainder = (Hash << Precision) | (static_cast<uint64>(1) << (Precision - 1));
+			const uint8 Rank = static_cast<uint8>(FPlatformMath::CountLeadingZeros64(Remainder) + 1);
+			uint8& Register = Registers[Index];
+			if (Rank > Register) { Register = Rank; }
+		}
+
+		void Merge(const FHyperLogLog& Other);
+
+		double Estimate() const;
+		FORCEINLINE int32 GetEstimate() const { return FMath::RoundToInt32(Estimate()); }
+
+	protected:
+		int32 Precision = 12;
+		TArray<uint8> Registers;
+
+		// 32bit type hashes are poorly distributed in their high bits; spread them over 64bits.
+		static FORCEINLINE uint64 Mix(uint64 Hash)
+		{
+			Hash ^= Hash >> 33;
+			Hash *= 0xff51afd7ed558ccdULL;
+			Hash ^= Hash >> 33;
+			Hash *= 0xc4ceb9fe1a85ec53ULL;
+			Hash ^= Hash >> 33;
+			return Hash;
+		}
+	};
+}
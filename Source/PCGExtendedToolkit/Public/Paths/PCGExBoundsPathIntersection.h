@@ -46,6 +46,7 @@ struct FPCGExBoundsPathIntersectionContext final : FPCGExPathProcessorContext
 	friend class FPCGExBoundsPathIntersectionElement;
 
 	TSharedPtr<PCGExData::FFacade> BoundsDataFacade;
+	TSharedPtr<PCGExGeo::FPointBoxCloud> Cloud; // Shared by all processors, BVH built once during boot
 };
 
 class FPCGExBoundsPathIntersectionElement final : public FPCGExPathProcessorElement
@@ -68,7 +69,9 @@ namespace PCGExPathIntersections
 		bool bClosedLoop = false;
 		int32 LastIndex = 0;
 		TSharedPtr<PCGExGeo::FPointBoxCloud> Cloud;
-		TSharedPtr<PCGExGeo::FSegmentation> Segmentation;
+
+		// Per-segment cuts, indexed by segment start point then compacted in path order once counted
+		TArray<TSharedPtr<PCGExGeo::FIntersections>> SegmentIntersections;
 
 		FPCGExBoxIntersectionDetails Details;
 
@@ -81,7 +84,7 @@ namespace PCGExPathIntersections
 		virtual ~FProcessor() override;
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager) override;
-		void FindIntersections(const int32 Index) const;
+		void FindIntersections(const int32 Index);
 		void InsertIntersections(const int32 Index) const;
 		void OnInsertionComplete();
 
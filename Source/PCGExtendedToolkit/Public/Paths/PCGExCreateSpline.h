@@ -82,6 +82,18 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings)
 	FPCGExAttachmentRules AttachmentRules;
 
+	/** If enabled, spline components from a previous generation are matched by path id and updated in place (or left untouched if their content didn't change), instead of being recreated. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable, EditCondition="Mode != EPCGCreateSplineMode::CreateDataOnly"))
+	bool bReuseComponents = true;
+
+	/** If enabled, the path id used to match existing components is read from this attribute (first point) instead of the input order. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, InlineEditConditionToggle))
+	bool bUsePathIdAttribute = false;
+
+	/** Stable identifier of the path, read from the first point. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition = "bUsePathIdAttribute"))
+	FName PathIdAttribute = "PathId";
+
 	bool GetApplyTangents() const
 	{
 		return (!bApplyCustomPointType && DefaultPointType == EPCGExSplinePointType::CurveCustomTangent);
@@ -93,6 +105,13 @@ struct FPCGExCreateSplineContext final : FPCGExPathProcessorContext
 	friend class FPCGExCreateSplineElement;
 
 	TSet<AActor*> NotifyActors;
+
+	/** Pops the spline this node left unused in the previous generation for the given path id, if any. Game thread only. */
+	UPCGExManagedReusableComponent* PopReusableSpline(const int32 PathId);
+
+protected:
+	bool bReusePoolInitialized = false;
+	TMap<int32, TObjectPtr<UPCGExManagedReusableComponent>> ReusePool;
 };
 
 class FPCGExCreateSplineElement final : public FPCGExPathProcessorElement
@@ -120,6 +139,9 @@ namespace PCGExCreateSpline
 		bool bApplyTangents = false;
 		float MaxIndex = 0.0;
 
+		int32 PathId = -1;
+		uint32 ContentHash = 0;
+
 		TSharedPtr<PCGExData::TBuffer<FVector>> ArriveTangent;
 		TSharedPtr<PCGExData::TBuffer<FVector>> LeaveTangent;
 
@@ -144,6 +166,7 @@ namespace PCGExCreateSpline
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager) override;
 		virtual void PrepareSingleLoopScopeForPoints(const PCGExMT::FScope& Scope) override;
 		virtual void ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope) override;
+		virtual void OnPointsProcessingComplete() override;
 		virtual void Output() override;
 		virtual void Cleanup() override;
 	};
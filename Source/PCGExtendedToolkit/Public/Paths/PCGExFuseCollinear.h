@@ -19,6 +19,8 @@ class UPCGExFuseCollinearSettings : public UPCGExPathProcessorSettings
 	GENERATED_BODY()
 
 public:
+	explicit UPCGExFuseCollinearSettings(const FObjectInitializer& ObjectInitializer);
+
 	//~Begin UPCGSettings
 #if WITH_EDITOR
 	PCGEX_NODE_INFOS(FuseCollinear, "Path : Fuse Collinear", "FuseCollinear paths points.");
@@ -93,6 +95,21 @@ namespace PCGExFuseCollinear
 		TArray<FPCGPoint>* OutPoints = nullptr;
 		FVector LastPosition = FVector::ZeroVector;
 
+		struct FWindowResult
+		{
+			TArray<int32> Kept;
+			FVector EntryPosition = FVector::ZeroVector; // Last kept position when reaching the window start, as found by walking the halo
+			FVector ExitPosition = FVector::ZeroVector;
+		};
+
+		TSharedPtr<PCGExPaths::FPathWindows> Windows;
+		TArray<FWindowResult> WindowResults;
+
+		/** Whether the point is kept given the last kept position, which is updated accordingly. */
+		bool IsKept(const int32 Index, FVector& InOutLastPosition) const;
+		void ProcessWindow(const PCGExPaths::FPathWindow& Window);
+		void WalkWindow(const PCGExPaths::FPathWindow& Window, FWindowResult& Result, FVector& InOutLastPosition) const;
+
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade):
 			TPointsProcessor(InPointDataFacade)
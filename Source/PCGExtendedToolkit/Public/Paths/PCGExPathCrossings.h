@@ -13,8 +13,16 @@
 
 
 #include "SubPoints/DataBlending/PCGExSubPointsBlendOperation.h"
+#include "Geometry/PCGExGeo.h"
 #include "PCGExPathCrossings.generated.h"
 
+UENUM()
+enum class EPCGExPathCrossingsSearchMode : uint8
+{
+	Octree = 0 UMETA(DisplayName = "Octree", ToolTip="Query each edge against every path' edge octree. Good for sparse inputs."),
+	Sweep  = 1 UMETA(DisplayName = "Plane Sweep", ToolTip="Run a single parallel plane sweep over the 2D projection of all edges. Scales much better on dense path networks."),
+};
+
 /**
  * 
  */
@@ -51,6 +59,14 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExPathEdgeIntersectionDetails IntersectionDetails;
 
+	/** How candidate edges are found before being tested against each other. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable))
+	EPCGExPathCrossingsSearchMode SearchMode = EPCGExPathCrossingsSearchMode::Octree;
+
+	/** Projection plane used by the plane sweep. Crossings are still validated in 3D against the tolerance. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="SearchMode==EPCGExPathCrossingsSearchMode::Sweep", EditConditionHides))
+	FPCGExGeo2DProjectionDetails ProjectionDetails = FPCGExGeo2DProjectionDetails(false);
+
 	/** Blending applied on intersecting points along the path prev and next point. This is different from inheriting from external properties. */
 	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = Settings, Instanced, meta=(PCG_Overridable, ShowOnlyInnerProperties, NoResetToDefault))
 	TObjectPtr<UPCGExSubPointsBlendOperation> Blending;
@@ -120,6 +136,9 @@ struct FPCGExPathCrossingsContext final : FPCGExPathProcessorContext
 
 	TSharedPtr<PCGExDetails::FDistances> Distances;
 	FPCGExBlendingDetails CrossingBlending;
+
+	FPCGExGeo2DProjectionDetails ProjectionDetails;
+	TSharedPtr<PCGExPaths::FPathEdgeSweep> EdgeSweep;
 };
 
 class FPCGExPathCrossingsElement final : public FPCGExPathProcessorElement
@@ -154,6 +173,8 @@ namespace PCGExPathCrossings
 
 	class FProcessor final : public PCGExPointsMT::TPointsProcessor<FPCGExPathCrossingsContext, UPCGExPathCrossingsSettings>
 	{
+		friend class FBatch;
+
 		bool bClosedLoop = false;
 		bool bSelfIntersectionOnly = false;
 		bool bCanCut = true;
@@ -183,6 +204,8 @@ namespace PCGExPathCrossings
 		TSharedPtr<PCGExData::TBuffer<double>> AlphaWriter;
 		TSharedPtr<PCGExData::TBuffer<FVector>> CrossWriter;
 
+		int32 SweepIndex = -1;
+
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
 			: TPointsProcessor(InPointDataFacade)
@@ -201,4 +224,14 @@ namespace PCGExPathCrossings
 		virtual void CompleteWork() override;
 		virtual void Write() override;
 	};
+
+	class FBatch final : public PCGExPointsMT::TBatch<FProcessor>
+	{
+	public:
+		explicit FBatch(FPCGExContext* InContext, const TArray<TWeakPtr<PCGExData::FPointIO>>& InPointsCollection);
+		virtual void CompleteWork() override;
+
+	protected:
+		void BuildEdgeSweep();
+	};
 }
@@ -50,6 +50,13 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, DisplayPriority=-1, EditCondition="bSupportClosedLoops", EditConditionHides, HideEditConditionToggle))
 	FPCGExPathClosedLoopDetails ClosedLoop;
 
+	UPROPERTY()
+	bool bSupportWindowing = false;
+
+	/** Splitting of very long paths into windows processed in parallel. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable, EditCondition="bSupportWindowing", EditConditionHides, HideEditConditionToggle), AdvancedDisplay)
+	FPCGExPathWindowingDetails Windowing;
+
 	/** If enabled, collections that have less than 2 points won't be processed and be omitted from the output. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable), AdvancedDisplay)
 	bool bOmitInvalidPathsOutputs = true;
@@ -15,6 +15,18 @@
 
 #include "PCGExPathSplineMesh.generated.h"
 
+#define PCGEX_FOREACH_SPLINEMESH_SEGMENT_DATA(MACRO)\
+MACRO(EndPos, FVector, Params.EndPos)\
+MACRO(StartTangent, FVector, Params.StartTangent)\
+MACRO(EndTangent, FVector, Params.EndTangent)\
+MACRO(StartScale, FVector2D, Params.StartScale)\
+MACRO(EndScale, FVector2D, Params.EndScale)\
+MACRO(StartRoll, double, Params.StartRoll)\
+MACRO(EndRoll, double, Params.EndRoll)\
+MACRO(StartOffset, FVector2D, Params.StartOffset)\
+MACRO(EndOffset, FVector2D, Params.EndOffset)\
+MACRO(UpVector, FVector, UpVector)
+
 /**
  * 
  */
@@ -118,6 +130,18 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="CollectionSource!=EPCGExCollectionSource::AttributeSet"))
 	bool bForceDefaultDescriptor = false;
 
+	/** How segments are emitted. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable))
+	EPCGExSplineMeshOutputMode OutputMode = EPCGExSplineMeshOutputMode::Components;
+
+	/** Prefix of the segment data attributes (EndPos, StartTangent, EndTangent, StartScale, EndScale, StartRoll, EndRoll, StartOffset, EndOffset, UpVector). */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="OutputMode != EPCGExSplineMeshOutputMode::Components", EditConditionHides))
+	FString SegmentDataPrefix = TEXT("SplineMesh_");
+
+	/** If enabled, spline mesh components spawned by a previous generation are reused instead of being destroyed and recreated. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable, EditCondition="OutputMode != EPCGExSplineMeshOutputMode::SegmentData"))
+	bool bReuseComponents = true;
+
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	TSoftObjectPtr<AActor> TargetActor;
 
@@ -138,6 +162,13 @@ struct FPCGExPathSplineMeshContext final : FPCGExPathProcessorContext
 	TSet<AActor*> NotifyActors;
 
 	TObjectPtr<UPCGExMeshCollection> MainCollection;
+
+	/** Pops a spline mesh left unused by the previous generation, parented to the given actor. Game thread only. */
+	UPCGExManagedReusableComponent* PopReusableSplineMesh(const AActor* InParent);
+
+protected:
+	bool bReusePoolInitialized = false;
+	TMap<const AActor*, TArray<TObjectPtr<UPCGExManagedReusableComponent>>> ReusePool;
 };
 
 class FPCGExPathSplineMeshElement final : public FPCGExPathProcessorElement
@@ -172,6 +203,7 @@ namespace PCGExPathSplineMesh
 		bool bClosedLoop = false;
 		bool bApplyScaleToFit = false;
 		bool bUseTags = false;
+		bool bEmitSegmentData = false;
 
 		int32 LastIndex = 0;
 
@@ -198,6 +230,10 @@ namespace PCGExPathSplineMesh
 
 		TArray<PCGExPaths::FSplineMeshSegment> Segments;
 
+#define PCGEX_SEGMENT_DATA_DECL(_NAME, _TYPE, _ACCESSOR) TSharedPtr<PCGExData::TBuffer<_TYPE>> _NAME##Writer;
+		PCGEX_FOREACH_SPLINEMESH_SEGMENT_DATA(PCGEX_SEGMENT_DATA_DECL)
+#undef PCGEX_SEGMENT_DATA_DECL
+
 		ESplineMeshAxis::Type SplineMeshAxisConstant = ESplineMeshAxis::Type::X;
 
 	public:
@@ -7,7 +7,9 @@
 #include "Collections/PCGExMeshCollection.h"
 #include "Components/SplineMeshComponent.h"
 #include "Data/PCGSplineStruct.h"
+#include "PCGManagedResource.h"
 #include "Graph/PCGExEdge.h"
+#include "PCGExScopedContainers.h"
 
 #include "PCGExPaths.generated.h"
 
@@ -44,6 +46,14 @@ enum class EPCGExPathNormalDirection : uint8
 	AverageNormal = 2 UMETA(DisplayName = "Average Normal", ToolTip="..."),
 };
 
+UENUM()
+enum class EPCGExSplineMeshOutputMode : uint8
+{
+	Components  = 0 UMETA(DisplayName = "Components", Tooltip="Spawn one spline mesh component per segment"),
+	SegmentData = 1 UMETA(DisplayName = "Segment Data", Tooltip="Don't spawn anything, write segment parameters to attributes so a single merged or instanced representation can be built downstream"),
+	Both        = 2 UMETA(DisplayName = "Both", Tooltip="Spawn components and write segment data"),
+};
+
 UENUM()
 enum class EPCGExSplineMeshUpMode : uint8
 {
@@ -52,6 +62,38 @@ enum class EPCGExSplineMeshUpMode : uint8
 	Tangents  = 2 UMETA(DisplayName = "From Tangents (Gimbal fix)", Tooltip="Automatically computed up vector from tangents to enforce gimbal fix")
 };
 
+/**
+ * Managed component that survives soft cleanups, so regenerating can reuse it instead of destroying & recreating it.
+ * Components still unused once generation completes are released by the PCG component.
+ */
+UCLASS(BlueprintType)
+class UPCGExManagedReusableComponent : public UPCGManagedComponent
+{
+	GENERATED_BODY()
+
+public:
+	/** Identifies what the component was generated from, if the owning node keys reuse on it. */
+	UPROPERTY()
+	int32 ReuseId = -1;
+
+	/** UID of the settings that generated the component, so nodes sharing a PCG component don't reuse each other's. */
+	UPROPERTY()
+	uint64 ReuseOwner = 0;
+
+	/** Hash of the content the component was last built from, if the owning node tracks it. */
+	UPROPERTY()
+	uint32 ContentHash = 0;
+
+	virtual bool SupportsComponentReset() const override { return true; }
+	virtual void ResetComponent() override
+	{
+		// Left as-is until it's either reused or released
+	}
+
+	template <typename T>
+	T* GetComponent() const { return Cast<T>(GeneratedComponent.Get()); }
+};
+
 USTRUCT(BlueprintType)
 struct PCGEXTENDEDTOOLKIT_API FPCGExPathOutputDetails
 {
@@ -249,6 +291,26 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExPathIntersectionDetails
 	FORCEINLINE bool CheckDot(const double InDot) const { return InDot <= MaxDot && InDot >= MinDot; }
 };
 
+USTRUCT(BlueprintType)
+struct PCGEXTENDEDTOOLKIT_API FPCGExPathWindowingDetails
+{
+	GENERATED_BODY()
+
+	/** If enabled, long paths are split into overlapping windows processed in parallel, then stitched back in order. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable))
+	bool bEnabled = false;
+
+	/** Number of points owned by each window. Paths with less than two windows' worth of points are processed as a whole. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable, EditCondition="bEnabled", ClampMin=64))
+	int32 WindowSize = 65536;
+
+	/** Number of extra points each window reads before the points it owns. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable, EditCondition="bEnabled", ClampMin=0))
+	int32 HaloSize = 1024;
+
+	bool ShouldSplit(const int32 NumPoints) const { return bEnabled && NumPoints >= WindowSize * 2; }
+};
+
 namespace PCGExPaths
 {
 	PCGEX_CTX_STATE(State_BuildingPaths)
@@ -261,6 +323,33 @@ namespace PCGExPaths
 	const FName SourceTriggerFilters = TEXT("Trigger Conditions");
 	const FName SourceShiftFilters = TEXT("Shift Conditions");
 
+	struct PCGEXTENDEDTOOLKIT_API FPathWindow
+	{
+		int32 Index = -1;
+		int32 Start = 0;     // First owned point
+		int32 End = 0;       // One past the last owned point
+		int32 HaloStart = 0; // First readable point before Start
+	};
+
+	/**
+	 * Splits a path into contiguous windows processed as independent scopes, each one reading a halo of preceding points.
+	 * Owned ranges don't overlap and are sorted along the path, so per-window results can be stitched back in window order.
+	 * Halos are clamped to the start of the path; closed loops that need to read across the seam must wrap indices themselves.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FPathWindows : public TSharedFromThis<FPathWindows>
+	{
+	public:
+		int32 NumPoints = 0;
+		TArray<FPathWindow> Windows;
+
+		FPathWindows(const int32 InNumPoints, const int32 InWindowSize, const int32 InHaloSize);
+
+		FORCEINLINE int32 Num() const { return Windows.Num(); }
+
+		/** Runs ProcessWindow for each window in parallel, OnComplete (if any) once they're all done. */
+		void Process(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager, TFunction<void(const FPathWindow&)>&& ProcessWindow, TFunction<void()>&& OnComplete = nullptr);
+	};
+
 	struct PCGEXTENDEDTOOLKIT_API FPathMetrics
 	{
 		FPathMetrics() = default;
@@ -730,6 +819,84 @@ namespace PCGExPaths
 		virtual void ProcessLastEdge(const FPath* Path, const FPathEdge& Edge) override;
 	};
 
+	/**
+	 * Plane-sweep broadphase over the 2D projection of many paths' edges.
+	 * Edges are sorted once along the projected X axis, then each sorted scope sweeps forward independently
+	 * and emits directed candidate pairs (edge can be cut by other) into its own scoped array.
+	 * Candidates are finally scattered into flat per-edge ranges, so consumers read them without locking.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FPathEdgeSweep : public TSharedFromThis<FPathEdgeSweep>
+	{
+	public:
+		enum EFlags : uint8
+		{
+			None     = 0,
+			CanCut   = 1 << 0,
+			CanBeCut = 1 << 1,
+		};
+
+		struct FSweepEdge
+		{
+			FVector2D A = FVector2D::ZeroVector;
+			FVector2D B = FVector2D::ZeroVector;
+			FBox2D Box = FBox2D(ForceInit);
+			double Length = 0;
+			int32 Path = -1;
+			int32 Edge = -1;
+			uint8 Flags = None;
+		};
+
+		struct FEdgeRef
+		{
+			int32 Path = -1;
+			int32 Edge = -1;
+
+			FEdgeRef() = default;
+
+			FEdgeRef(const int32 InPath, const int32 InEdge)
+				: Path(InPath), Edge(InEdge)
+			{
+			}
+		};
+
+		FPathEdgeSweep(const FQuat& InProjection, const double InTolerance, const bool InSelfIntersectionOnly, const bool InEnableSelfIntersection);
+
+		/** Register a path and its per-edge filters. Returns the path index within the sweep. */
+		int32 Add(const TSharedPtr<FPath>& InPath, const TArray<int8>& InCanCut, const TArray<int8>& InCanBeCut, const bool bInCanCut = true, const bool bInCanBeCut = true);
+
+		/** Sort registered edges along the sweep axis. Must be called once every path has been added. */
+		void Prepare();
+
+		FORCEINLINE int32 Num() const { return Items.Num(); }
+
+		void PrepareScopes(const TArray<PCGExMT::FScope>& Loops);
+		void Sweep(const PCGExMT::FScope& Scope);
+
+		/** Scatter candidate pairs into per-edge ranges. */
+		void Compile();
+
+		FORCEINLINE const FPath* GetPath(const int32 Index) const { return Paths[Index].Get(); }
+		TArrayView<const FEdgeRef> GetCandidates(const int32 PathIndex, const int32 EdgeIndex) const;
+
+	protected:
+		FQuat Projection = FQuat::Identity;
+		double Tolerance = 0;
+		bool bSelfIntersectionOnly = false;
+		bool bEnableSelfIntersection = true;
+
+		TArray<TSharedPtr<FPath>> Paths;
+		TArray<int32> EdgeOffsets;
+		int32 NumEdges = 0;
+
+		TArray<FSweepEdge> Items;
+		TSharedPtr<PCGExMT::TScopedArray<uint64>> ScopedPairs;
+
+		TArray<int32> CandidateOffsets;
+		TArray<FEdgeRef> Candidates;
+
+		bool AreSeparated(const FSweepEdge& Item, const FSweepEdge& Other) const;
+	};
+
 	TSharedPtr<FPath> MakePath(const TArrayView<const FPCGPoint> InPoints, const double Expansion, const bool bClosedLoop);
 	TSharedPtr<FPath> MakePath(const TArrayView<const FVector> InPositions, const double Expansion, const bool bClosedLoop);
 
@@ -96,7 +96,9 @@ namespace PCGExResamplePath
 	{
 		int32 NumSamples = 0;
 		double SampleLength = 0;
-		TArray<FPointSample> Samples;
+		int32 LastPointIndex = 0;
+		bool bClosedLoop = false;
+		bool bPreserveLastPoint = false;
 
 		TSharedPtr<PCGExDataBlending::FMetadataBlender> MetadataBlender;
 
@@ -110,6 +112,11 @@ namespace PCGExResamplePath
 		}
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager) override;
+
+		/** Segment a sample at the given distance along the path falls onto; sample-independent so it can be resolved from any thread. */
+		int32 FindSegment(const double Distance) const;
+		void ComputeSample(const int32 Index, FPointSample& OutSample) const;
+
 		virtual void PrepareSingleLoopScopeForPoints(const PCGExMT::FScope& Scope) override;
 		virtual void ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope) override;
 		virtual void CompleteWork() override;
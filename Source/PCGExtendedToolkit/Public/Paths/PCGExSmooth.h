@@ -10,6 +10,7 @@
 
 
 #include "Smoothing/PCGExSmoothingOperation.h"
+#include "Smoothing/PCGExSmoothingKernel.h"
 #include "PCGExSmooth.generated.h"
 
 /**
@@ -111,8 +112,20 @@ namespace PCGExSmooth
 
 		TSharedPtr<PCGExDataBlending::FMetadataBlender> MetadataBlender;
 		UPCGExSmoothingOperation* TypedOperation = nullptr;
+		TSharedPtr<PCGExSmoothing::FPathState> PathState;
 		bool bClosedLoop = false;
 
+		// Linear blends are smoothed for the whole path at once through the windowed kernel,
+		// the per-point blender only deals with what's left.
+		FPCGExBlendingDetails FallbackBlending;
+		bool bHasFallbackBlending = true;
+		TSharedPtr<PCGExSmoothing::FWindowedKernel> Kernel;
+		TArray<TFunction<void()>> KernelJobs;
+
+		TArray<PCGExSmoothing::FScratch> ScopedScratch;
+
+		void InitKernel(const EPCGExSmoothingKernel InKernel, TSet<FName>& OutKernelAttributes);
+
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade):
 			TPointsProcessor(InPointDataFacade)
@@ -122,8 +135,10 @@ namespace PCGExSmooth
 		virtual ~FProcessor() override;
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager) override;
+		virtual void PrepareLoopScopesForPoints(const TArray<PCGExMT::FScope>& Loops) override;
 		virtual void PrepareSingleLoopScopeForPoints(const PCGExMT::FScope& Scope) override;
 		virtual void ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope) override;
+		virtual void OnPointsProcessingComplete() override;
 		virtual void CompleteWork() override;
 	};
 }
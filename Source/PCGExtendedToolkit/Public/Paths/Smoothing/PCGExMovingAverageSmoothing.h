@@ -18,13 +18,34 @@ class UPCGExMovingAverageSmoothing : public UPCGExSmoothingOperation
 	GENERATED_BODY()
 
 public:
+	/** Shape of the weights within the smoothing window. Only applies to 'Weight' blending; 'Average' blending always uses a box. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings)
+	EPCGExSmoothingKernel Kernel = EPCGExSmoothingKernel::Triangular;
+
+	virtual void CopySettingsFrom(const UPCGExOperation* Other) override
+	{
+		Super::CopySettingsFrom(Other);
+		if (const UPCGExMovingAverageSmoothing* TypedOther = Cast<UPCGExMovingAverageSmoothing>(Other))
+		{
+			Kernel = TypedOther->Kernel;
+		}
+	}
+
+	virtual bool GetWindowedKernel(EPCGExSmoothingKernel& OutKernel) const override
+	{
+		OutKernel = Kernel;
+		return true;
+	}
+
 	virtual void SmoothSingle(
 		const TSharedRef<PCGExData::FPointIO>& Path,
 		PCGExData::FPointRef& Target,
 		const double Smoothing,
 		const double Influence,
 		PCGExDataBlending::FMetadataBlender* MetadataBlender,
-		const bool bClosedLoop) override
+		const bool bClosedLoop,
+		const PCGExSmoothing::FPathState* PathState,
+		PCGExSmoothing::FScratch& Scratch) override
 	{
 		const int32 NumPoints = Path->GetNum();
 		const int32 MaxIndex = NumPoints - 1;
@@ -41,7 +62,7 @@ public:
 			for (int i = -SafeWindowSize; i <= SafeWindowSize; i++)
 			{
 				const int32 Index = PCGExMath::Tile(Target.Index + i, 0, MaxIndex);
-				const double Weight = (1 - (static_cast<double>(FMath::Abs(i)) / SafeWindowSize)) * Influence;
+				const double Weight = GetKernelWeight(i, SafeWindowSize) * Influence;
 				MetadataBlender->Blend(Target, Path->GetInPointRef(Index), Target, Weight);
 				Count++;
 				TotalWeight += Weight;
@@ -54,7 +75,7 @@ public:
 				const int32 Index = Target.Index + i;
 				if (!FMath::IsWithin(Index, 0, NumPoints)) { continue; }
 
-				const double Weight = (1 - (static_cast<double>(FMath::Abs(i)) / SafeWindowSize)) * Influence;
+				const double Weight = GetKernelWeight(i, SafeWindowSize) * Influence;
 				MetadataBlender->Blend(Target, Path->GetInPointRef(Index), Target, Weight);
 				Count++;
 				TotalWeight += Weight;
@@ -65,4 +86,22 @@ public:
 
 		MetadataBlender->CompleteBlending(Target, Count, TotalWeight);
 	}
+
+protected:
+	double GetKernelWeight(const int32 Offset, const double WindowSize) const
+	{
+		switch (Kernel)
+		{
+		default: ;
+		case EPCGExSmoothingKernel::Triangular:
+			return 1 - (static_cast<double>(FMath::Abs(Offset)) / WindowSize);
+		case EPCGExSmoothingKernel::Box:
+			return 1;
+		case EPCGExSmoothingKernel::Gaussian:
+			{
+				const double Sigma = WindowSize / 3;
+				return FMath::Exp(-(Offset * Offset) / (2 * Sigma * Sigma));
+			}
+		}
+	}
 };
@@ -10,6 +10,44 @@
 
 #include "PCGExRadiusSmoothing.generated.h"
 
+UENUM()
+enum class EPCGExRadiusSmoothingDistance : uint8
+{
+	Euclidean = 0 UMETA(DisplayName = "Euclidean", ToolTip="Blend every point within the radius, wherever it sits along the path."),
+	AlongPath = 1 UMETA(DisplayName = "Along Path", ToolTip="Blend points whose distance along the path is within the radius."),
+};
+
+namespace PCGExSmoothing
+{
+	class FRadiusPathState : public FPathState
+	{
+	public:
+		TArray<FVector> Positions;
+
+		// Along path : cumulative arc length per point
+		TArray<double> ArcLengths;
+		double TotalLength = 0;
+		bool bLoop = false;
+
+		// Euclidean : points bucketed by hashed grid cell, cell size matches the largest radius
+		double CellSize = 1;
+		uint32 BucketMask = 0;
+		TArray<FIntVector> Cells;
+		TArray<int32> BucketStarts;
+		TArray<int32> BucketEntries;
+
+		FORCEINLINE FIntVector GetCell(const FVector& Position) const
+		{
+			return FIntVector(FMath::FloorToInt32(Position.X / CellSize), FMath::FloorToInt32(Position.Y / CellSize), FMath::FloorToInt32(Position.Z / CellSize));
+		}
+
+		FORCEINLINE uint32 GetBucket(const FIntVector& Cell) const
+		{
+			return ((static_cast<uint32>(Cell.X) * 73856093u) ^ (static_cast<uint32>(Cell.Y) * 19349663u) ^ (static_cast<uint32>(Cell.Z) * 83492791u)) & BucketMask;
+		}
+	};
+}
+
 /**
  * 
  */
@@ -19,49 +57,25 @@ class UPCGExRadiusSmoothing : public UPCGExSmoothingOperation
 	GENERATED_BODY()
 
 public:
+	/** How the distance to neighbors is measured. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings)
+	EPCGExRadiusSmoothingDistance Distance = EPCGExRadiusSmoothingDistance::Euclidean;
+
+	virtual void CopySettingsFrom(const UPCGExOperation* Other) override;
+
+	virtual TSharedPtr<PCGExSmoothing::FPathState> PrepareForPath(const TSharedRef<PCGExData::FPointIO>& Path, const double MaxSmoothing, const bool bClosedLoop) const override;
+
 	virtual void SmoothSingle(
 		const TSharedRef<PCGExData::FPointIO>& Path,
 		PCGExData::FPointRef& Target,
 		const double Smoothing,
 		const double Influence,
 		PCGExDataBlending::FMetadataBlender* MetadataBlender,
-		const bool bClosedLoop) override
-	{
-		const double RadiusSquared = Smoothing * Smoothing;
-
-		if (Influence == 0) { return; }
-
-		const FVector Origin = Target.Point->Transform.GetLocation();
-		const FPCGPoint* StartData = Path->GetIn()->GetPoints().GetData();
-
-		TArray<int32> Indices;
-		TArray<double> Weights;
-
-		Indices.Reserve(10);
-		Weights.Reserve(10);
-
-		double TotalWeight = 0;
-		Path->GetIn()->GetOctree().FindElementsWithBoundsTest(
-			FBoxCenterAndExtent(Origin, FVector(Smoothing)), [&](const FPCGPointRef& Ref)
-			{
-				const double Dist = FVector::DistSquared(Origin, Ref.Point->Transform.GetLocation());
-				const int32 OtherIndex = Ref.Point - StartData;
-				if (Dist >= RadiusSquared || OtherIndex == Target.Index) { return; }
-
-				Indices.Add(OtherIndex);
-				Weights.Add((1 - (Dist / RadiusSquared)) * Influence);
-			});
-
-		if (Indices.IsEmpty()) { return; }
-
-		MetadataBlender->PrepareForBlending(Target);
-
-		for (int i = 0; i < Indices.Num(); i++)
-		{
-			MetadataBlender->Blend(Target, Path->GetInPointRef(Indices[i]), Target, Weights[i]);
-			TotalWeight += Weights[i];
-		}
+		const bool bClosedLoop,
+		const PCGExSmoothing::FPathState* PathState,
+		PCGExSmoothing::FScratch& Scratch) override;
 
-		MetadataBlender->CompleteBlending(Target, Indices.Num(), TotalWeight);
-	}
+protected:
+	static void GatherEuclidean(const PCGExSmoothing::FRadiusPathState& State, const int32 Index, const double Radius, const double Influence, PCGExSmoothing::FScratch& Scratch);
+	static void GatherAlongPath(const PCGExSmoothing::FRadiusPathState& State, const int32 Index, const double Radius, const double Influence, PCGExSmoothing::FScratch& Scratch);
 };
@@ -0,0 +1,127 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExSmoothingOperation.h"
+
+namespace PCGExSmoothing
+{
+	/**
+	 * Windowed moving average evaluated from running prefix sums, so each point costs the same regardless of its window.
+	 * Weighted kernels are built from cascaded box passes, which only ever need plain prefix sums.
+	 * Closed loops wrap around (windows wider than the path included), open paths truncate the window at both ends.
+	 */
+	class FWindowedKernel : public TSharedFromThis<FWindowedKernel>
+	{
+	public:
+		TArray<int32> Radii; // Half-window per point, 0 leaves the point untouched
+		TArray<int8> Mask;   // Whether the smoothed value of a point is written
+
+		FWindowedKernel(const int32 InNumPoints, const bool bInClosedLoop)
+			: NumPoints(InNumPoints), bClosedLoop(bInClosedLoop)
+		{
+			Radii.Init(0, NumPoints);
+			Mask.Init(0, NumPoints);
+		}
+
+		/** Smooth In into Out, writing only masked points. In & Out may alias. */
+		template <typename T>
+		void Apply(const EPCGExSmoothingKernel Kernel, const TArrayView<const T>& In, const TArrayView<T>& Out) const
+		{
+			using TAcc = std::decay_t<decltype(std::declval<T>() * 1.0)>;
+
+			TArray<TAcc> Values;
+			TArray<TAcc> Smoothed;
+			Values.SetNumUninitialized(NumPoints);
+			for (int i = 0; i < NumPoints; i++) { Values[i] = In[i]; }
+
+			if (Kernel == EPCGExSmoothingKernel::Gaussian)
+			{
+				// Three successive box passes, a third of the window each, approximate a gaussian spanning the window
+				TArray<int32> SubRadii;
+				SubRadii.SetNumUninitialized(NumPoints);
+				for (int i = 0; i < NumPoints; i++) { SubRadii[i] = Radii[i] > 0 ? FMath::Max(1, FMath::RoundToInt32(Radii[i] / 3.0)) : 0; }
+
+				Pass(Values, Smoothed, SubRadii, SubRadii);
+				Pass(Smoothed, Values, SubRadii, SubRadii);
+				Pass(Values, Smoothed, SubRadii, SubRadii);
+			}
+			else if (Kernel == EPCGExSmoothingKernel::Triangular)
+			{
+				// Two boxes of Radius points, mirrored so their convolution is centered, give w(j) = 1 - |j - t| / Radius
+				TArray<int32> Before;
+				TArray<int32> After;
+				Before.SetNumUninitialized(NumPoints);
+				After.SetNumUninitialized(NumPoints);
+				for (int i = 0; i < NumPoints; i++)
+				{
+					Before[i] = Radii[i] > 0 ? Radii[i] / 2 : 0;
+					After[i] = Radii[i] > 0 ? Radii[i] - 1 - Before[i] : 0;
+				}
+
+				Pass(Values, Smoothed, Before, After);
+				Pass(Smoothed, Values, After, Before);
+				Smoothed = MoveTemp(Values);
+			}
+			else
+			{
+				Pass(Values, Smoothed, Radii, Radii);
+			}
+
+			for (int i = 0; i < NumPoints; i++) { if (Mask[i]) { Out[i] = static_cast<T>(Smoothed[i]); } }
+		}
+
+	protected:
+		int32 NumPoints = 0;
+		bool bClosedLoop = false;
+
+		/** Box average over [t - Before[t], t + After[t]], evaluated from running prefix sums */
+		template <typename TAcc>
+		void Pass(const TArray<TAcc>& In, TArray<TAcc>& Out, const TArray<int32>& Before, const TArray<int32>& After) const
+		{
+			const int64 N = NumPoints;
+
+			// Sums are taken relative to the first value to keep them small on large world-space paths
+			const TAcc Origin = In[0];
+
+			TArray<TAcc> Sums;
+			Sums.SetNumUninitialized(N + 1);
+			Sums[0] = In[0] * 0.0;
+
+			for (int32 j = 0; j < N; j++) { Sums[j + 1] = Sums[j] + (In[j] - Origin); }
+
+			const TAcc& Period = Sums[N];
+
+			// Sum of v[j % N] for j < K, extended over any number of periods
+			auto Sum = [&](const int64 K) -> TAcc
+			{
+				if (!bClosedLoop) { return Sums[K]; }
+				const int64 Q = K >= 0 ? K / N : -((-K + N - 1) / N);
+				return Period * static_cast<double>(Q) + Sums[K - Q * N];
+			};
+
+			Out.SetNumUninitialized(N);
+
+			for (int32 t = 0; t < N; t++)
+			{
+				if (Before[t] <= 0 && After[t] <= 0)
+				{
+					Out[t] = In[t];
+					continue;
+				}
+
+				int64 Lo = t - Before[t];
+				int64 Hi = t + After[t];
+				if (!bClosedLoop)
+				{
+					Lo = FMath::Max<int64>(0, Lo);
+					Hi = FMath::Min<int64>(N - 1, Hi);
+				}
+
+				Out[t] = Origin + (Sum(Hi + 1) - Sum(Lo)) * (1.0 / static_cast<double>(Hi - Lo + 1));
+			}
+		}
+	};
+}
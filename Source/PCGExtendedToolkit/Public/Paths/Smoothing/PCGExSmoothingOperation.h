@@ -8,6 +8,31 @@
 #include "Data/Blending/PCGExMetadataBlender.h"
 #include "PCGExSmoothingOperation.generated.h"
 
+UENUM()
+enum class EPCGExSmoothingKernel : uint8
+{
+	Triangular = 0 UMETA(DisplayName = "Triangular", ToolTip="Weights fall off linearly with the distance to the smoothed point."),
+	Box        = 1 UMETA(DisplayName = "Box", ToolTip="Every point within the window has the same weight."),
+	Gaussian   = 2 UMETA(DisplayName = "Gaussian", ToolTip="Gaussian-like falloff, approximated with successive box passes."),
+};
+
+namespace PCGExSmoothing
+{
+	/** Per-scope scratch, reused across SmoothSingle calls of the same loop scope. */
+	struct FScratch
+	{
+		TArray<int32> Indices;
+		TArray<double> Weights;
+	};
+
+	/** Per-path data built by PrepareForPath. Owned by the path processor, as operations are shared by the whole batch. */
+	class FPathState
+	{
+	public:
+		virtual ~FPathState() = default;
+	};
+}
+
 /**
  * 
  */
@@ -17,13 +42,24 @@ class PCGEXTENDEDTOOLKIT_API UPCGExSmoothingOperation : public UPCGExOperation
 	GENERATED_BODY()
 
 public:
+	/** Called once per path before any SmoothSingle call. MaxSmoothing is the largest smoothing amount any point may request. */
+	virtual TSharedPtr<PCGExSmoothing::FPathState> PrepareForPath(const TSharedRef<PCGExData::FPointIO>& Path, const double MaxSmoothing, const bool bClosedLoop) const
+	{
+		return nullptr;
+	}
+
 	virtual void SmoothSingle(
 		const TSharedRef<PCGExData::FPointIO>& Path,
 		PCGExData::FPointRef& Target,
 		const double Smoothing,
 		const double Influence,
 		PCGExDataBlending::FMetadataBlender* MetadataBlender,
-		const bool bClosedLoop)
+		const bool bClosedLoop,
+		const PCGExSmoothing::FPathState* PathState,
+		PCGExSmoothing::FScratch& Scratch)
 	{
 	}
+
+	/** Whether this operation is a plain windowed average that can be evaluated for the whole path at once, and with which kernel. */
+	virtual bool GetWindowedKernel(EPCGExSmoothingKernel& OutKernel) const { return false; }
 };
@@ -126,14 +126,7 @@ struct FPCGExSampleOverlapStatsContext final : FPCGExPointsProcessorContext
 {
 	friend class FPCGExSampleOverlapStatsElement;
 
-	mutable FRWLock OverlapLock;
-	TMap<uint64, TSharedPtr<PCGExSampleOverlapStats::FOverlap>> OverlapMap;
-
-	TSharedPtr<PCGExSampleOverlapStats::FOverlap> RegisterOverlap(
-		PCGExSampleOverlapStats::FProcessor* InA,
-		PCGExSampleOverlapStats::FProcessor* InB,
-		const FBox& InIntersection);
-
+	virtual void BatchProcessing_InitialProcessingDone() override;
 	virtual void BatchProcessing_WorkComplete() override;
 
 	PCGEX_FOREACH_FIELD_SAMPLEOVERLAPSTATS(PCGEX_OUTPUT_DECL_TOGGLE)
@@ -224,7 +217,6 @@ namespace PCGExSampleOverlapStats
 
 		TArray<TSharedPtr<PCGExDiscardByOverlap::FPointBounds>> LocalPointBounds;
 
-		mutable FRWLock RegistrationLock;
 		TArray<TSharedRef<FOverlap>> Overlaps;
 		TArray<TSharedRef<FOverlap>> ManagedOverlaps;
 
@@ -262,8 +254,6 @@ namespace PCGExSampleOverlapStats
 			LocalPointBounds[Index] = InPointBounds;
 		}
 
-		void RegisterOverlap(FProcessor* InOtherProcessor, const FBox& Intersection);
-
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager) override;
 		void ResolveOverlap(const int32 Index);
 		void WriteSingleData(const int32 Index);